@@ -3,6 +3,6 @@
 
 // ensure this is >= to MAX_NUM_DIGITS_XX for all benchmarks, else we will get
 // a precision error and the benchmarks will not be meaningful.
-template<> std::optional<size_t> boost::real::const_precision_iterator<int>::global_maximum_precision = 10;
+template<> std::atomic<size_t> boost::real::const_precision_iterator<int>::global_maximum_precision{10};
 
 BENCHMARK_MAIN();
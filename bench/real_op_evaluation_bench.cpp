@@ -113,4 +113,34 @@ BENCHMARK_CAPTURE(BM_RealComparisonEvaluation, GREATER_THAN, Comparison::GREATER
 
 BENCHMARK_CAPTURE(BM_RealComparisonEvaluation, EQUALS, Comparison::EQUALS)
     ->RangeMultiplier(MULTIPLIER_OE)->Range(MIN_NUM_DIGITS,MAX_NUM_DIGITS)->Unit(benchmark::kMillisecond)
-    ->Complexity();
\ No newline at end of file
+    ->Complexity();
+/// builds exp(first) + ... + exp(last - 1) as a balanced tree of additions
+boost::real::real<> balancedExpSum(int first, int last) {
+    if (last - first == 1) {
+        return boost::real::real<>::exp(boost::real::real<>(std::to_string(first)));
+    }
+    int middle = (first + last) / 2;
+    return balancedExpSum(first, middle) + balancedExpSum(middle, last);
+}
+
+/// benchmarks the evaluation of a balanced tree of 64 exponentials on a pool of n threads,
+/// n = 0 evaluates it on the calling thread only
+void BM_RealParallelTreeEvaluation(benchmark::State& state) {
+    std::unique_ptr<boost::real::work_stealing_pool> pool;
+    if (state.range(0) > 0) {
+        pool = std::make_unique<boost::real::work_stealing_pool>(state.range(0));
+    }
+    boost::real::const_precision_iterator<int>::thread_pool = pool.get();
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::real<> sum = balancedExpSum(1, 65);
+        state.ResumeTiming();
+
+        sum.get_real_itr().cend(); // force evaluation
+    }
+
+    boost::real::const_precision_iterator<int>::thread_pool = nullptr;
+}
+
+BENCHMARK(BM_RealParallelTreeEvaluation)->Arg(0)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -9,12 +9,19 @@
 #include <real/real_exception.hpp>
 #include <real/integer_number.hpp>
 #include <real/real_rational.hpp>
+#include <real/thread_pool.hpp>
 #include <limits>
 #include <memory>
 #include <variant>
 #include <assert.h>
 #include <iterator>
+#include <map>
+#include <mutex>
+#include <atomic>
 #include <optional>
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 namespace boost {
     namespace real{
@@ -23,7 +30,11 @@ namespace boost {
      * of all three kinds of reals
      * 
      * @note variant and visit/visitors are used extensively in this implementation
-     * @TODO: consider doing traversals to lower the demands of recursion
+     * @note operation trees are refined in a precomputed topological order (see refinement_order),
+     * so their depth is not limited by the call stack and shared operands are refined once
+     * @note numbers sharing operands may be evaluated and compared on several threads, every
+     * refinement step holds the locks of the node it refines and of its operands (see lock_operands),
+     * and the intervals are read by other threads as copies taken under the lock of their node
      * @sa documention on std::variant, std::visit
      */
         template<class... Ts> struct overloaded : Ts... { using Ts::operator()...; };
@@ -39,14 +50,258 @@ namespace boost {
         /// the default max precision to use if the user hasn't provided one.
         const precision_t DEFAULT_MAXIMUM_PRECISION = 10;
 
+        /**
+         * @brief How the precision grows between two refinements of a search for a precision, such
+         * as a comparison: one digit at a time (LINEAR), doubling it, following the Fibonacci
+         * sequence or growing by a half.
+         */
+        enum class PRECISION_SCHEDULE {LINEAR, DOUBLING, FIBONACCI, ONE_AND_A_HALF};
+
+        /**
+         * @brief The sequence of precisions given by a PRECISION_SCHEDULE, starting at precision 1.
+         * With a geometric schedule, deciding something that needs precision P takes O(log P)
+         * refinements instead of O(P), at the cost of overshooting P by a constant factor.
+         */
+        class precision_schedule {
+            PRECISION_SCHEDULE _schedule;
+            precision_t _previous = 1;
+            precision_t _current = 1;
+
+            public:
+            explicit precision_schedule(PRECISION_SCHEDULE schedule) : _schedule(schedule) {}
+
+            precision_t current() const {
+                return _current;
+            }
+
+            /// moves to the next precision of the schedule and returns it
+            precision_t next() {
+                precision_t next;
+                switch (_schedule) {
+                    case PRECISION_SCHEDULE::LINEAR:
+                        next = _current + 1;
+                        break;
+                    case PRECISION_SCHEDULE::DOUBLING:
+                        next = 2 * _current;
+                        break;
+                    case PRECISION_SCHEDULE::FIBONACCI:
+                        next = _current + _previous;
+                        break;
+                    default:
+                        next = _current + std::max<precision_t>(_current / 2, 1);
+                }
+                _previous = _current;
+                _current = next;
+                return next;
+            }
+        };
+
+        /**
+         * @brief The intervals a number was already computed at, keyed by precision and bounded by
+         * a memory budget. It is shared by all the iterators of the same number, so a precision
+         * reached by one of them (a comparison, printing or a user's cend()) is not recomputed
+         * by the others. When the budget is exceeded, the least precise intervals are evicted first.
+         */
+        template <typename T>
+        class interval_cache {
+            std::map<precision_t, interval<T>> _intervals;
+            size_t _memory = 0;
+            size_t _budget;
+            mutable std::mutex _mutex;
+
+            static size_t memory_of(const interval<T> &approximation) {
+                return sizeof(interval<T>) +
+                       (approximation.lower_bound.digits.capacity() + approximation.upper_bound.digits.capacity()) * sizeof(T);
+            }
+
+            void evict() {
+                while (_memory > _budget && !_intervals.empty()) {
+                    _memory -= memory_of(_intervals.begin()->second);
+                    _intervals.erase(_intervals.begin());
+                }
+            }
+
+            public:
+            /// the budget in bytes of every new cache, 0 disables caching
+            inline static size_t default_budget = 64 * 1024;
+
+            interval_cache() : _budget(default_budget) {}
+
+            /// the interval computed at precision, if it is cached
+            std::optional<interval<T>> find(precision_t precision) const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _intervals.find(precision);
+                if (it == _intervals.end()) {
+                    return std::nullopt;
+                }
+                return it->second;
+            }
+
+            void insert(precision_t precision, const interval<T> &approximation) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                size_t memory = memory_of(approximation);
+                if (memory > _budget || _intervals.count(precision) > 0) {
+                    return;
+                }
+                _intervals.emplace(precision, approximation);
+                _memory += memory;
+                evict();
+            }
+
+            void set_budget(size_t budget) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _budget = budget;
+                evict();
+            }
+
+            size_t memory_usage() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _memory;
+            }
+
+            size_t size() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _intervals.size();
+            }
+        };
+
+        namespace detail {
+            /// the operations that iterate their own operands while computing their interval
+            inline bool refines_operands(OPERATION op) {
+                switch (op) {
+                    case OPERATION::DIVISION:
+                    case OPERATION::INTEGER_POWER:
+                    case OPERATION::LOGARITHM:
+                    case OPERATION::TAN:
+                    case OPERATION::COT:
+                    case OPERATION::SEC:
+                    case OPERATION::COSEC:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            /// a mutex that is not copied along with the object owning it, every copy gets its own
+            struct owned_mutex {
+                mutable std::recursive_mutex mutex;
+
+                owned_mutex() = default;
+                owned_mutex(const owned_mutex &) {}
+                owned_mutex &operator=(const owned_mutex &) {
+                    return *this;
+                }
+            };
+
+            /**
+             * @brief The precision of an iterator, which is only changed holding the lock of the
+             * iterator but may be read without it, as when the operands already precise enough are
+             * skipped (see refinement_order). Copies of the iterator copy its value.
+             */
+            struct atomic_precision {
+                std::atomic<precision_t> value;
+
+                atomic_precision(precision_t precision = 0) : value(precision) {}
+                atomic_precision(const atomic_precision &other) : value(other.value.load()) {}
+                atomic_precision &operator=(const atomic_precision &other) {
+                    value = other.value.load();
+                    return *this;
+                }
+
+                atomic_precision &operator=(precision_t precision) {
+                    value = precision;
+                    return *this;
+                }
+
+                atomic_precision &operator+=(precision_t n) {
+                    value += n;
+                    return *this;
+                }
+
+                atomic_precision &operator++() {
+                    ++value;
+                    return *this;
+                }
+
+                operator precision_t() const {
+                    return value;
+                }
+            };
+
+            /**
+             * @brief Holds the locks of the iterators a refinement step reads or changes. They are
+             * taken all at once and in address order, so steps sharing operands cannot deadlock.
+             * A step nested in one that already holds the locks of a whole tree, on the same
+             * thread, takes no lock.
+             */
+            class evaluation_guard {
+                std::vector<std::recursive_mutex*> _mutexes;
+
+                /// the number of guards the current thread holds
+                inline static thread_local unsigned int _depth = 0;
+
+                public:
+                /// joins the guard the current thread already holds
+                evaluation_guard() {
+                    ++_depth;
+                }
+
+                explicit evaluation_guard(std::vector<std::recursive_mutex*> mutexes) : _mutexes(std::move(mutexes)) {
+                    std::sort(_mutexes.begin(), _mutexes.end(), std::less<std::recursive_mutex*>());
+                    _mutexes.erase(std::unique(_mutexes.begin(), _mutexes.end()), _mutexes.end());
+                    for (std::recursive_mutex *mutex : _mutexes) {
+                        mutex->lock();
+                    }
+                    ++_depth;
+                }
+
+                evaluation_guard(const evaluation_guard &) = delete;
+                evaluation_guard &operator=(const evaluation_guard &) = delete;
+
+                ~evaluation_guard() {
+                    --_depth;
+                    for (auto mutex = _mutexes.rbegin(); mutex != _mutexes.rend(); ++mutex) {
+                        (*mutex)->unlock();
+                    }
+                }
+
+                /// true if the current thread already holds the locks of a step
+                static bool nested() {
+                    return _depth > 0;
+                }
+            };
+        }
+
         template <typename T>
         class const_precision_iterator {
             public:
             /**
-             * @brief Optional user-provided maximum precision for all const_precision_iterators. 
+             * @brief Optional user-provided maximum precision for all const_precision_iterators,
+             * 0 (its initial value) when it is not set. It is atomic as every evaluation reads it.
              */
 
-            inline static std::optional<precision_t> global_maximum_precision;
+            inline static std::atomic<precision_t> global_maximum_precision;
+
+            /**
+             * @brief When set, the intervals of additions, subtractions and multiplications are
+             * refined from their previous interval using only the operand digits that changed.
+             * Otherwise every interval is recomputed from the full operand intervals.
+             */
+            inline static bool incremental_refinement = true;
+
+            /**
+             * @brief How comparisons grow the precision of their operands until they can decide,
+             * see PRECISION_SCHEDULE. Defaults to doubling it.
+             */
+            inline static PRECISION_SCHEDULE comparison_schedule = PRECISION_SCHEDULE::DOUBLING;
+
+            /**
+             * @brief When set, operation trees are refined on this pool: independent subtrees are
+             * refined concurrently and the expensive operations (exp, log and the trigonometric
+             * functions) compute their lower and upper bounds in parallel. The pool is owned by
+             * the user and must outlive its use.
+             */
+            inline static work_stealing_pool *thread_pool = nullptr;
             /// @TODO look into STL-style iterators
             // typedef std::forward_iterator_tag iterator_category;
             // typedef void difference_type (?);
@@ -62,14 +317,61 @@ namespace boost {
                 // (refer to real_data.hpp). Any time the variant is destroyed, so is this pointer.
                 std::shared_ptr<real_number<T>>  _real_ptr;
 
-                /// current iterator precision
-                precision_t _precision;
+                /// current iterator precision, it never decreases
+                detail::atomic_precision _precision;
 
                 /// local max precision, is used if set to > 0 by user
                 precision_t _maximum_precision = 0;
 
                 interval<T> _approximation_interval;
 
+                /// the intervals of this number already computed by any of its iterators, only kept for operations
+                std::shared_ptr<interval_cache<T>> _cache;
+
+                /// held while the iterator is refined, or while its interval is read by another evaluation
+                detail::owned_mutex _mutex;
+
+                /// the truncated operands a bound of a real_operation interval was last computed from
+                struct refinement_operands {
+                    exact_number<T> lhs;
+                    exact_number<T> rhs;
+                };
+
+                /**
+                 * @brief What the current interval of a real_operation was computed from, so the next
+                 * iteration can refine it instead of recomputing it, see update_operation_bound.
+                 * operands_case identifies which operand bounds were used and is -1 when there is
+                 * nothing to refine from.
+                 */
+                struct refinement_state {
+                    int operands_case = -1;
+                    refinement_operands lower;
+                    refinement_operands upper;
+                };
+
+                refinement_state _refinement;
+
+                /// the exponent of an INTEGER_POWER, decoded once from its rhs
+                struct power_exponent {
+                    exact_number<T> value;
+                    std::optional<unsigned long long> machine_value;
+                    bool even;
+                };
+
+                std::optional<power_exponent> _power_exponent;
+
+                // fwd decl'd. Definitions found in real_data.hpp
+                void update_operation_bound(exact_number<T> &bound, refinement_operands &stored, OPERATION op,
+                                            const exact_number<T> &lhs, bool lhs_upper,
+                                            const exact_number<T> &rhs, bool rhs_upper, bool incremental);
+                void update_operation_interval(real_operation<T> &ro, int operands_case);
+                void update_sum_interval(real_operation<T> &ro);
+                void update_product_interval(real_operation<T> &ro);
+                void update_power_interval(real_operation<T> &ro);
+                void update_sin_cos_interval(real_operation<T> &ro, bool sine);
+                std::pair<std::tuple<exact_number<T>, exact_number<T>>, std::tuple<exact_number<T>, exact_number<T>>>
+                sin_cos_bounds(const interval<T> &x) const;
+
                 void check_and_swap_boundaries() {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) { 
@@ -104,10 +406,11 @@ namespace boost {
                  * Preference is given: _maximum_precision > maximum_precision > DEFAULT_MAXIMUM_PRECISION
                  */
                 precision_t maximum_precision() const {
-                    if((_maximum_precision == 0) && !(global_maximum_precision))
+                    precision_t global = global_maximum_precision;
+                    if((_maximum_precision == 0) && (global == 0))
                         return DEFAULT_MAXIMUM_PRECISION;
                     else if (_maximum_precision == 0)
-                        return global_maximum_precision.value();
+                        return global;
                     else
                         return _maximum_precision;
                 }
@@ -135,9 +438,21 @@ namespace boost {
                 void update_operation_boundaries(real_operation<T> &ro);
 
                 /**
-                 * @brief Constructor for the least precise precision iterator
-                 */ 
-                explicit const_precision_iterator(real_number<T> * a) : _real_ptr(std::make_shared<real_number<T>>(*a)), _precision(1) {
+                 * @brief Constructor for the least precise precision iterator of a copy of *a. A number
+                 * already owned by a std::shared_ptr, as in real_data, is not copied by the constructor
+                 * taking the std::shared_ptr.
+                 */
+                explicit const_precision_iterator(real_number<T> * a) : const_precision_iterator(std::make_shared<real_number<T>>(*a)) {}
+
+                /**
+                 * @brief Constructor for the least precise precision iterator of the number a points
+                 * to, which is shared with the iterator rather than copied.
+                 *
+                 * @param cache - the intervals already computed by the other iterators of the number.
+                 * Operations get a new cache when it is not given.
+                 */
+                explicit const_precision_iterator(std::shared_ptr<real_number<T>> a, std::shared_ptr<interval_cache<T>> cache = nullptr)
+                        : _real_ptr(std::move(a)), _precision(1), _cache(std::move(cache)) {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) {
                             T base = (std::numeric_limits<T>::max() /4)*2 - 1;
@@ -181,81 +496,31 @@ namespace boost {
 
                         [this] (real_operation<T>& real) {
                             // we don't need to init operands here - they *SHOULD* already be at cbegin or >
+                            auto guard = lock_operands(real);
                             update_operation_boundaries(real);
                             // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
                             },
-
                         [this] (real_rational<T> &real){
-                            if(real.b == integer_number<T>("1")){
-                                real_number<T> tmp_num = real_number<T>(real_explicit<T>(real.a));
-                                (*this) = const_precision_iterator(std::make_shared<real_number<T>>(tmp_num));
+                            // the rational is iterated as the explicit number or the division it is equal to
+                            std::shared_ptr<interval_cache<T>> cache = std::move(this->_cache);
+                            if(real.b == literals::one_integer<T>){
+                                (*this) = const_precision_iterator(std::make_shared<real_number<T>>(real_explicit<T>(real.a)), cache);
                             }
                             else{
                                 auto a = std::make_shared<real_data<T>>(real_explicit<T>(real.a));
                                 auto b = std::make_shared<real_data<T>>(real_explicit<T>(real.b));
-                                real_number<T> tmp_num = real_number<T>(real_operation<T>(a, b, OPERATION::DIVISION));
-                                (*this) = const_precision_iterator(std::make_shared<real_number<T>>(tmp_num));
-
-                            }
-                        },
-                        
-                        [] (auto& real) {
-                            throw boost::real::bad_variant_access_exception();
-                            }
-                    }, *_real_ptr);
-                }
-
-                explicit const_precision_iterator(std::shared_ptr<real_number<T>>  a) : _real_ptr(a), _precision(1) {
-                    std::visit( overloaded { // perform operation on whatever is held in variant
-                        [this] (real_explicit<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
-                            this->_approximation_interval.lower_bound.exponent = real.exponent();
-                            this->_approximation_interval.upper_bound.exponent = real.exponent();
-                            this->_approximation_interval.lower_bound.positive = real.positive();
-                            this->_approximation_interval.upper_bound.positive = real.positive();
-
-                            T first_digit = real.digits()[0];
-                            this->_approximation_interval.lower_bound.digits.push_back(first_digit);
-
-                            if (first_digit == base) {
-                                this->_approximation_interval.upper_bound.digits.push_back(1);
-                                this->_approximation_interval.upper_bound.exponent++;
-                            } else if (this->_precision < real.digits().size()) {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit + 1);
-                            } else {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit);
-                            }
-                            this->check_and_swap_boundaries();
-                        },
-
-                        [this] (real_algorithm<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
-                            this->_approximation_interval.lower_bound.exponent = real.exponent();
-                            this->_approximation_interval.upper_bound.exponent = real.exponent();
-                            this->_approximation_interval.lower_bound.positive = real.positive();
-                            this->_approximation_interval.upper_bound.positive = real.positive();
-
-                            T first_digit = real[0];
-                            this->_approximation_interval.lower_bound.digits.push_back(first_digit);
-
-                            if (first_digit == base) {
-                                this->_approximation_interval.upper_bound.digits.push_back(1);
-                                this->_approximation_interval.upper_bound.exponent++;
-                            } else {
-                                this->_approximation_interval.upper_bound.digits.push_back(first_digit + 1);
+                                (*this) = const_precision_iterator(std::make_shared<real_number<T>>(real_operation<T>(a, b, OPERATION::DIVISION)), cache);
                             }
-                            this->check_and_swap_boundaries();
                         },
 
-                        [this] (real_operation<T>& real) {
-                            // we don't need to init operands here - they *SHOULD* already be at cbegin or >
-                            update_operation_boundaries(real);
-                            // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
-                            },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                             }
                     }, *_real_ptr);
+
+                    if (_cache == nullptr && std::holds_alternative<real_operation<T>>(*_real_ptr)) {
+                        _cache = std::make_shared<interval_cache<T>>();
+                    }
                 }
 
                 // fwd decl, defined in real_data.hpp
@@ -289,7 +554,7 @@ namespace boost {
                 }
 
                 const_precision_iterator cbegin() const {
-                    return const_precision_iterator(_real_ptr);
+                    return const_precision_iterator(_real_ptr, _cache);
                 }
 
                 /**
@@ -305,13 +570,58 @@ namespace boost {
                     return *this;
                 }
 
-                interval<T> get_interval() const {
+                const interval<T>& get_interval() const {
                     return _approximation_interval;
                 }
 
+                /**
+                 * @brief A copy of the interval taken holding the lock of the iterator. An iterator
+                 * shared with numbers evaluated on other threads must be read through it, as they
+                 * may narrow its interval meanwhile.
+                 */
+                interval<T> interval_snapshot() const {
+                    std::lock_guard<std::recursive_mutex> lock(mutex());
+                    return _approximation_interval;
+                }
+
+                precision_t get_precision() const {
+                    return _precision;
+                }
+
+                /// the intervals shared by the iterators of this number, nullptr if it is not an operation
+                interval_cache<T>* get_interval_cache() const {
+                    return _cache.get();
+                }
+
+                /**
+                 * @brief The lock of this iterator. An iterator shared as the operand of other numbers
+                 * must be copied or changed holding it, as their evaluations may refine it meanwhile.
+                 */
+                std::recursive_mutex& mutex() const {
+                    return _mutex.mutex;
+                }
+
                 // fwd decl, defined in real_data.hpp
+                detail::evaluation_guard lock_tree();
+                detail::evaluation_guard lock_operands(real_operation<T> &ro);
+                void release_operands(std::vector<std::shared_ptr<real_data<T>>> &operands);
+                void add_last_operand(real_operation<T> &ro);
+
+                /// a node of an operation tree to refine, operation is nullptr for explicit and algorithmic numbers
+                struct refinement_step {
+                    const_precision_iterator<T> *itr;
+                    real_operation<T> *operation;
+                };
+
+                // fwd decl, defined in real_data.hpp
+                std::vector<refinement_step> refinement_order(real_operation<T> &ro, precision_t target);
+                void refine_to_error(int error_exponent);
                 void operation_iterate(real_operation<T> &ro);
                 void operation_iterate_n_times(real_operation<T> &ro, int n);
+                void refine_step(refinement_step &step, precision_t target);
+                void parallel_refine(std::vector<refinement_step> &order, precision_t target);
+                bool restore_cached_interval(precision_t precision);
+                void cache_interval();
 
                 /**
                  * @brief It recalculates the approximation interval boundaries increasing the used
@@ -337,6 +647,7 @@ namespace boost {
                 void iterate_n_times(int n) {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this, &n] (real_explicit<T>& real) { 
+                            std::lock_guard<std::recursive_mutex> lock(mutex());
                             if (this->_precision >= real.digits().size()) {
                                 return;
                             }
@@ -392,15 +703,14 @@ namespace boost {
                            this->_precision = std::min(this->_precision + n, real.digits().size());
                         },
                         [this, &n] (real_algorithm<T>& real) {
+                           std::lock_guard<std::recursive_mutex> lock(mutex());
                            // If the number is negative, bounds are interpreted as mirrored:
                            // First, the operation is made as positive, and after bound calculation
                            // bounds are swapped to come back to the negative representation.
                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                            this->check_and_swap_boundaries();
 
-                           for (int i = 0; i < n; i++) {
-                               this->_approximation_interval.lower_bound.push_back((real)[this->_precision + i]);
-                           }
+                           real.get_digits(this->_precision, n, std::back_inserter(this->_approximation_interval.lower_bound.digits));
 
                            this->_approximation_interval.upper_bound.clear();
                            this->_approximation_interval.upper_bound.digits.resize(this->_approximation_interval.lower_bound.size());
@@ -450,7 +760,10 @@ namespace boost {
                         return false;
                     }
 
-                    return (other._real_ptr == this->_real_ptr) && (other._approximation_interval == this->_approximation_interval);
+                    if (&other == this) {
+                        return true;
+                    }
+                    return (other._real_ptr == this->_real_ptr) && (other.interval_snapshot() == this->interval_snapshot());
                 }
 
                 /**
@@ -0,0 +1,417 @@
+#ifndef BOOST_REAL_CONSTANTS_HPP
+#define BOOST_REAL_CONSTANTS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <real/real_exception.hpp>
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// the constants kept by boost::real::constants
+        enum class CONSTANT {PI, E, LN2, LN10, SQRT2};
+
+        namespace detail {
+            template <typename T>
+            T constant_base() {
+                return (std::numeric_limits<T>::max() / 4) * 2;
+            }
+
+            /**
+             * @brief value as an exact_number. The constants are built from these instead of the
+             * numbers of boost::real::literals, because the numbers of boost::real::irrational may
+             * reach them during static initialization, before those are initialized.
+             */
+            template <typename T>
+            exact_number<T> exact_integer(unsigned long long value) {
+                const unsigned long long base = constant_base<T>();
+                std::vector<T> digits;
+                while (value != 0) {
+                    digits.insert(digits.begin(), (T) (value % base));
+                    value /= base;
+                }
+                exact_number<T> number(digits, true);
+                number.normalize();
+                return number;
+            }
+
+            /**
+             * @brief The first precision digits of number. Unlike up_to, which also steps one
+             * unit down to stay a bound of the digits it drops, this is the plain truncation.
+             */
+            template <typename T>
+            exact_number<T> truncated(const exact_number<T> &number, size_t precision) {
+                if (precision >= number.digits.size()) {
+                    return number;
+                }
+                exact_number<T> result = number;
+                result.digits.resize(precision);
+                return result;
+            }
+
+            /// a double in [1, base] as an exact_number, with an error below one unit of its second digit
+            template <typename T>
+            exact_number<T> exact_from_double(double value) {
+                const T base = constant_base<T>();
+                if (value >= base) {
+                    return exact_number<T>(std::vector<T> {1}, 2, true);
+                }
+                double integer_part = std::floor(value);
+                T fraction = std::min((T) ((value - integer_part) * base), (T) (base - 1));
+                exact_number<T> number(std::vector<T> {(T) integer_part, fraction}, 1, true);
+                number.normalize();
+                return number;
+            }
+
+            /**
+             * @brief 1 / number to precision significant digits, by Newton steps r' = r (2 - number r)
+             * from a double approximation, doubling the precision at every step. It costs a few
+             * products of growing sizes instead of a division.
+             */
+            template <typename T>
+            exact_number<T> exact_reciprocal(exact_number<T> number, size_t precision) {
+                const int exponent = number.exponent;
+                number.exponent = 0;
+
+                // the mantissa of number, in [1 / base, 1)
+                double mantissa = 0;
+                double scale = 1;
+                for (size_t i = 0; i < number.digits.size() && i < 3; ++i) {
+                    scale /= constant_base<T>();
+                    mantissa += number.digits[i] * scale;
+                }
+
+                exact_number<T> result = exact_from_double<T>(1 / mantissa);
+                for (size_t exact = 1; exact < precision;) {
+                    exact = std::min(2 * exact, precision);
+                    exact_number<T> truncated = number.up_to(exact + 2, false);
+                    result = (result * (detail::exact_integer<T>(2) - truncated * result)).up_to(exact + 2, false);
+                }
+                result.exponent -= exponent;
+                return result;
+            }
+
+            /**
+             * @brief The sum S = sum over k >= 0 of a(k) / b(k) p(0) ... p(k) / (q(0) ... q(k)) of a
+             * series of integer terms, by binary splitting: the integers P, Q, B and T of the terms
+             * k0 to k1 - 1 are merged pairwise from single terms, so that the series costs a few
+             * products of balanced sizes instead of a division per term. The sum of the terms
+             * 0 to terms() - 1 is T / (B Q). More terms are merged into the integers kept so far.
+             */
+            template <typename T>
+            class binary_splitting {
+                public:
+                struct term {
+                    exact_number<T> a, b, p, q;
+                };
+
+                private:
+                struct split {
+                    exact_number<T> p, q, b, t;
+                };
+
+                std::function<term(unsigned long long)> _term;
+                split _sum;
+                unsigned long long _terms = 0;
+
+                static split merge(const split &left, const split &right) {
+                    return {left.p * right.p, left.q * right.q, left.b * right.b,
+                            right.b * right.q * left.t + left.b * left.p * right.t};
+                }
+
+                split range(unsigned long long first, unsigned long long last) const {
+                    if (last - first == 1) {
+                        term single = _term(first);
+                        exact_number<T> t = single.a * single.p;
+                        return {std::move(single.p), std::move(single.q), std::move(single.b), std::move(t)};
+                    }
+                    unsigned long long middle = first + (last - first) / 2;
+                    return merge(range(first, middle), range(middle, last));
+                }
+
+                public:
+                explicit binary_splitting(std::function<term(unsigned long long)> term_of) : _term(std::move(term_of)) {}
+
+                /// sums at least the first terms terms
+                void extend(unsigned long long terms) {
+                    if (terms <= _terms) {
+                        return;
+                    }
+                    _sum = (_terms == 0) ? range(0, terms) : merge(_sum, range(_terms, terms));
+                    _terms = terms;
+                }
+
+                unsigned long long terms() const {
+                    return _terms;
+                }
+
+                /// T, the numerator of the sum
+                const exact_number<T> &numerator() const {
+                    return _sum.t;
+                }
+
+                /// B Q, the denominator of the sum
+                exact_number<T> denominator() const {
+                    return _sum.b * _sum.q;
+                }
+
+                /// the sum of the terms so far, to precision significant digits
+                exact_number<T> sum(size_t precision) const {
+                    return (numerator().up_to(precision + 1, false) * exact_reciprocal(denominator(), precision + 1)).up_to(precision + 1, false);
+                }
+            };
+
+            /**
+             * @brief 1 / sqrt(n), refined by the Newton steps y' = y (3 - n y^2) / 2 that only take
+             * products. The digits reached are kept, so a higher precision continues from them.
+             */
+            template <typename T>
+            class inverse_square_root {
+                exact_number<T> _radicand;
+                exact_number<T> _value;
+                size_t _precision = 0;
+
+                public:
+                explicit inverse_square_root(unsigned long long n) : _radicand(exact_integer<T>(n)) {
+                    // a double in [1 / base, 1) times base, exact to its first digit
+                    _value = exact_from_double<T>(1 / std::sqrt((double) n) * constant_base<T>());
+                    _value.exponent -= 1;
+                    _precision = 1;
+                }
+
+                /// 1 / sqrt(n) with at least precision exact significant digits
+                const exact_number<T> &refine(size_t precision) {
+                    static const exact_number<T> three = exact_integer<T>(3);
+                    static const exact_number<T> half(std::vector<T> {constant_base<T>() / 2}, 0, true);
+                    while (_precision < precision) {
+                        size_t next = std::min(2 * _precision, precision);
+                        _value = (_value * (three - _radicand * _value * _value) * half).up_to(next + 2, false);
+                        _precision = next;
+                    }
+                    return _value;
+                }
+            };
+
+            /// the atanh(1 / x) = sum over k of 1 / ((2k + 1) x^(2k + 1)) series
+            template <typename T>
+            binary_splitting<T> atanh_series(unsigned long long x) {
+                return binary_splitting<T>([x](unsigned long long k) {
+                    using term = typename binary_splitting<T>::term;
+                    if (k == 0) {
+                        return term {detail::exact_integer<T>(1), detail::exact_integer<T>(1), detail::exact_integer<T>(1), exact_integer<T>(x)};
+                    }
+                    return term {detail::exact_integer<T>(1), exact_integer<T>(2 * k + 1), detail::exact_integer<T>(1), exact_integer<T>(x * x)};
+                });
+            }
+
+            /// the number of terms of the atanh(1 / x) series for precision digits
+            template <typename T>
+            unsigned long long atanh_terms(unsigned long long x, size_t precision) {
+                return (unsigned long long) (precision * std::log((double) constant_base<T>()) / (2 * std::log((double) x))) + 2;
+            }
+            /**
+             * @brief Whether the guard digits of value, the digits after the first precision ones,
+             * are all 0 or all base - 1, so that an error below one unit of the last of them could
+             * still change the first precision digits.
+             */
+            template <typename T>
+            bool ambiguous_guard_digits(const exact_number<T> &value, size_t precision, size_t guard_digits) {
+                bool zeros = true;
+                bool maximums = true;
+                for (size_t i = precision; i < precision + guard_digits; ++i) {
+                    const T digit = (i < value.digits.size()) ? value.digits[i] : 0;
+                    zeros = zeros && digit == 0;
+                    maximums = maximums && digit == constant_base<T>() - 1;
+                }
+                return zeros || maximums;
+            }
+        }
+
+        /**
+         * @brief A registry of the constants pi, e, ln 2, ln 10 and sqrt(2) shared by the whole
+         * process (shared()). Every constant is kept at the highest precision computed so far:
+         * lower precisions are served by truncation, and higher ones continue the computation,
+         * by merging the new terms of its series and by more Newton steps of its square roots,
+         * instead of restarting it. A constant is computed at twice the precision it had at
+         * least, so growing requests cost a logarithmic number of evaluations.
+         *
+         * @details pi = 426880 sqrt(10005) / S, where S is the Chudnovsky series, e is the sum
+         * of 1 / k!, ln 2 = 2 atanh(1 / 3), ln 10 = 3 ln 2 + 2 atanh(1 / 9) and sqrt(2) = 2 / sqrt(2).
+         * The constants are evaluated with guard digits, in which an error carried into the
+         * kept digits would need a run of guard digits all 0 or all base - 1, and such a run
+         * makes the constant be evaluated again with twice the guard digits. Each constant has
+         * its own lock, so they may be used from several threads at once.
+         */
+        template <typename T = int>
+        class constants {
+            static constexpr size_t GUARD_DIGITS = 3;
+
+            struct entry {
+                // the constant, truncated to precision significant digits
+                exact_number<T> value;
+                size_t precision = 0;
+                // the constant to at least the given precision, the state of its series kept in between
+                std::function<exact_number<T>(size_t)> evaluate;
+                std::mutex mutex;
+            };
+
+            std::array<entry, 5> _entries;
+
+            entry &entry_of(CONSTANT constant) {
+                return _entries[(size_t) constant];
+            }
+
+            /// the constant to at least precision digits, entry.mutex must be held
+            const exact_number<T> &reach(entry &constant, size_t precision) {
+                if (constant.precision < precision) {
+                    precision = std::max(precision, 2 * constant.precision);
+                    size_t guard_digits = GUARD_DIGITS;
+                    exact_number<T> value = constant.evaluate(precision + guard_digits);
+                    value.normalize_left();
+                    while (detail::ambiguous_guard_digits(value, precision, guard_digits)) {
+                        guard_digits *= 2;
+                        value = constant.evaluate(precision + guard_digits);
+                        value.normalize_left();
+                    }
+                    constant.value = detail::truncated(value, precision);
+                    constant.precision = precision;
+                }
+                return constant.value;
+            }
+
+            static std::function<exact_number<T>(size_t)> pi() {
+                auto series = std::make_shared<detail::binary_splitting<T>>([](unsigned long long k) {
+                    using term = typename detail::binary_splitting<T>::term;
+                    if (k == 0) {
+                        return term {detail::exact_integer<T>(13591409), detail::exact_integer<T>(1), detail::exact_integer<T>(1), detail::exact_integer<T>(1)};
+                    }
+                    const exact_number<T> a = detail::exact_integer<T>(13591409) + detail::exact_integer<T>(545140134) * detail::exact_integer<T>(k);
+                    // 640320^3 / 24 = 26680 * 640320^2
+                    static const exact_number<T> q_factor = detail::exact_integer<T>(26680) * detail::exact_integer<T>(640320) * detail::exact_integer<T>(640320);
+                    exact_number<T> p = detail::exact_integer<T>(6 * k - 5) * detail::exact_integer<T>(2 * k - 1) * detail::exact_integer<T>(6 * k - 1);
+                    p.positive = false;
+                    const exact_number<T> kk = detail::exact_integer<T>(k);
+                    return term {a, detail::exact_integer<T>(1), std::move(p), q_factor * kk * kk * kk};
+                });
+                auto inverse_sqrt = std::make_shared<detail::inverse_square_root<T>>(10005);
+
+                return [series, inverse_sqrt](size_t precision) {
+                    // every term adds about 14.18 decimal digits
+                    static const exact_number<T> factor = detail::exact_integer<T>(426880) * detail::exact_integer<T>(10005);
+                    series->extend((unsigned long long) (precision * std::log10((double) detail::constant_base<T>()) / 14.18) + 2);
+
+                    // sqrt(10005) = 10005 / sqrt(10005), and pi = 426880 sqrt(10005) B Q / T
+                    exact_number<T> pi = (factor * inverse_sqrt->refine(precision + 1)).up_to(precision + 1, false) *
+                                         series->denominator().up_to(precision + 1, false);
+                    return (pi.up_to(precision + 1, false) * detail::exact_reciprocal(series->numerator(), precision + 1)).up_to(precision + 1, false);
+                };
+            }
+
+            static std::function<exact_number<T>(size_t)> e() {
+                auto series = std::make_shared<detail::binary_splitting<T>>([](unsigned long long k) {
+                    using term = typename detail::binary_splitting<T>::term;
+                    const exact_number<T> one = detail::exact_integer<T>(1);
+                    return term {one, one, one, (k == 0) ? one : detail::exact_integer<T>(k)};
+                });
+
+                return [series](size_t precision) {
+                    // the terms up to 1 / N! with N! above base^precision
+                    const double target = (precision + 1) * std::log((double) detail::constant_base<T>());
+                    unsigned long long terms = std::max<unsigned long long>(series->terms(), 2);
+                    while (std::lgamma((double) terms) < target) {
+                        terms += terms / 2;
+                    }
+                    series->extend(terms);
+                    return series->sum(precision);
+                };
+            }
+
+            static std::function<exact_number<T>(size_t)> ln2() {
+                auto series = std::make_shared<detail::binary_splitting<T>>(detail::atanh_series<T>(3));
+                return [series](size_t precision) {
+                    series->extend(detail::atanh_terms<T>(3, precision + 1));
+                    return series->sum(precision + 1) * detail::exact_integer<T>(2);
+                };
+            }
+
+            std::function<exact_number<T>(size_t)> ln10() {
+                auto series = std::make_shared<detail::binary_splitting<T>>(detail::atanh_series<T>(9));
+                return [this, series](size_t precision) {
+                    static const exact_number<T> three = detail::exact_integer<T>(3);
+                    series->extend(detail::atanh_terms<T>(9, precision + 1));
+                    exact_number<T> ln2 = get(CONSTANT::LN2, precision + 1, false);
+                    return ln2 * three + series->sum(precision + 1) * detail::exact_integer<T>(2);
+                };
+            }
+
+            static std::function<exact_number<T>(size_t)> sqrt2() {
+                auto inverse_sqrt = std::make_shared<detail::inverse_square_root<T>>(2);
+                return [inverse_sqrt](size_t precision) {
+                    return inverse_sqrt->refine(precision + 1) * detail::exact_integer<T>(2);
+                };
+            }
+
+            public:
+            constants() {
+                entry_of(CONSTANT::PI).evaluate = pi();
+                entry_of(CONSTANT::E).evaluate = e();
+                entry_of(CONSTANT::LN2).evaluate = ln2();
+                entry_of(CONSTANT::LN10).evaluate = ln10();
+                entry_of(CONSTANT::SQRT2).evaluate = sqrt2();
+            }
+
+            constants(const constants &) = delete;
+            constants &operator=(const constants &) = delete;
+
+            /// the registry shared by the whole process
+            static constants &shared() {
+                static constants registry;
+                return registry;
+            }
+
+            /**
+             * @brief The constant rounded down (upper = false) or up (upper = true) to precision
+             * significant digits. The constants are irrational, so the result is a strict bound.
+             */
+            exact_number<T> get(CONSTANT constant, size_t precision, bool upper) {
+                entry &kept = entry_of(constant);
+                std::lock_guard<std::mutex> lock(kept.mutex);
+                exact_number<T> bound = detail::truncated(reach(kept, precision), precision);
+                if (upper) {
+                    bound = bound + exact_number<T>(std::vector<T> {1}, bound.exponent - (int) precision + 1, true);
+                }
+                return bound;
+            }
+
+            /**
+             * @brief Writes the significant digits start, ..., start + count - 1 of the constant
+             * to out. The exponent of the first one is get(constant, 1, false).exponent.
+             */
+            void get_digits(CONSTANT constant, unsigned int start, unsigned int count, T *out) {
+                entry &kept = entry_of(constant);
+                std::lock_guard<std::mutex> lock(kept.mutex);
+                const exact_number<T> &value = reach(kept, (size_t) start + count);
+                for (unsigned int i = 0; i < count; ++i) {
+                    out[i] = (start + i < value.digits.size()) ? value.digits[start + i] : 0;
+                }
+            }
+
+            /// the number of significant digits the constant is kept with
+            size_t precision(CONSTANT constant) {
+                entry &kept = entry_of(constant);
+                std::lock_guard<std::mutex> lock(kept.mutex);
+                return kept.precision;
+            }
+        };
+    }
+}
+
+#endif //BOOST_REAL_CONSTANTS_HPP
@@ -10,6 +10,7 @@
 #include <limits>
 #include <iterator>
 #include <cctype>
+#include <optional>
 
 namespace boost {
     namespace real {
@@ -51,11 +52,14 @@ namespace boost {
             }
 
             /// adds other to *this. disregards sign -- that's taken care of in the operators.
-            void add_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
+            void add_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
                 int carry = 0;
                 std::vector<T> temp;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
+                temp.reserve(std::max(fractional_length + integral_length, 0) + 1);
+
+                // the digits are collected from the lowest to the highest and reversed at the end
 
                 // we walk the numbers from the lowest to the highest digit
                 for (int i = fractional_length - 1; i >= -integral_length; i--) {
@@ -95,22 +99,26 @@ namespace boost {
                         carry = 1;
                         digit = 0;
                     }
-                    temp.insert(temp.begin(), digit);
+                    temp.push_back(digit);
                 }
                 if (carry == 1) {
-                    temp.insert(temp.begin(), 1);
+                    temp.push_back(1);
                     integral_length++;
                 }
-                this->digits = temp;
+                std::reverse(temp.begin(), temp.end());
+                this->digits = std::move(temp);
                 this->exponent = integral_length;
                 this->normalize();
             }
 
             /// subtracts other from *this, disregards sign -- that's taken care of in the operators
-            void subtract_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
+            void subtract_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
                 std::vector<T> result;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
+                result.reserve(std::max(fractional_length + integral_length, 0));
+
+                // the digits are collected from the lowest to the highest and reversed at the end
                 int borrow = 0;
                 // we walk the numbers from the lowest to the highest digit
                 for (int i = fractional_length - 1; i >= -integral_length; i--) {
@@ -141,9 +149,10 @@ namespace boost {
                         }
 
                     }                    
-                    result.insert(result.begin(), digit);
+                    result.push_back(digit);
                 }
-                this->digits = result;
+                std::reverse(result.begin(), result.end());
+                this->digits = std::move(result);
                 this->exponent = integral_length;
                 this->normalize();
             }
@@ -201,13 +210,10 @@ namespace boost {
 
             /// multiplies *this by other
             void standard_multiplication(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2) {
-                // will keep the result number in vector in reverse order
-                // Digits: .123 | Exponent: -3 | .000123 <--- Number size is the Digits size less the exponent
-                // Digits: .123 | Exponent: 2  | 12.3
+                // will keep the result number in vector in reverse order. The digits of the product
+                // do not depend on the exponents, which only give the exponent of the result.
                 std::vector<T> temp;
                 size_t new_size = this->digits.size() + other.digits.size();
-                if (this->exponent < 0) new_size -= this->exponent; // <--- Less the exponent
-                if (other.exponent < 0) new_size -= other.exponent; // <--- Less the exponent
 
                 temp.assign(new_size, 0);
 
@@ -395,6 +401,87 @@ namespace boost {
 
             }
 
+            /**
+             * @brief Squares *this. Below the karatsuba threshold, every cross product a_i * a_j
+             * with i < j is computed once and the sum of them doubled, which takes about half the
+             * digit products of standard_multiplication. Above it, the karatsuba split is squared
+             * with three recursive squarings: a^2 = al^2 * base^2h + ((al + ar)^2 - al^2 - ar^2) * base^h + ar^2.
+             */
+            void square(const T base = (std::numeric_limits<T>::max() / 4) * 2) {
+                const int size = this->digits.size();
+                const int result_exponent = 2 * this->exponent;
+
+                if (size > KARATSUBA_BASE_CASE_THRESHOLD) {
+                    const int right_half_length = size - size / 2;
+                    exact_number<T> left(std::vector<T> (this->digits.begin(), this->digits.begin() + size / 2), true);
+                    exact_number<T> right(std::vector<T> (this->digits.begin() + size / 2, this->digits.end()), true);
+                    left.normalize();
+                    right.normalize();
+
+                    exact_number<T> middle = left;
+                    middle.add_vector(right, base - 1);
+                    left.square(base);
+                    right.square(base);
+                    middle.square(base);
+                    middle.subtract_vector(left, base - 1);
+                    middle.subtract_vector(right, base - 1);
+
+                    left.exponent += 2 * right_half_length;
+                    middle.exponent += right_half_length;
+                    left.add_vector(middle, base - 1);
+                    left.add_vector(right, base - 1);
+
+                    *this = std::move(left);
+                    this->exponent += result_exponent - 2 * size;
+                    this->positive = true;
+                    this->normalize();
+                    return;
+                }
+
+                // the digit a_i * a_j lands at index i + j + 1 of a 2 * size digits integer
+                std::vector<T> cross(2 * size, 0);
+                for (int i = size - 1; i >= 0; --i) {
+                    T carry = 0;
+                    for (int j = size - 1; j > i; --j) {
+                        T &cell = cross[i + j + 1];
+                        T rem = mul_mod(this->digits[i], this->digits[j], base);
+                        T q = mult_div(this->digits[i], this->digits[j], base);
+                        T rem_s;
+                        if (cell >= base - carry) {
+                            rem_s = carry - (base - cell);
+                            ++q;
+                        } else {
+                            rem_s = cell + carry;
+                        }
+                        if (rem >= base - rem_s) {
+                            rem -= (base - rem_s);
+                            ++q;
+                        } else {
+                            rem += rem_s;
+                        }
+                        cell = rem;
+                        carry = q;
+                    }
+                    cross[2 * i + 1] = carry;
+                }
+
+                std::vector<T> diagonal(2 * size, 0);
+                for (int i = 0; i < size; ++i) {
+                    diagonal[2 * i] = mult_div(this->digits[i], this->digits[i], base);
+                    diagonal[2 * i + 1] = mul_mod(this->digits[i], this->digits[i], base);
+                }
+
+                exact_number<T> doubled(cross, 2 * size, true);
+                exact_number<T> result = doubled;
+                result.add_vector(doubled, base - 1);
+                result.add_vector(exact_number<T>(diagonal, 2 * size, true), base - 1);
+
+                *this = std::move(result);
+                this->exponent += result_exponent - 2 * size;
+                this->positive = true;
+                this->normalize();
+            }
+
             //Performs long division on dividend by divisor and returns result in quotient
             std::vector<T> long_divide_vectors(
                     const std::vector<T>& dividend,
@@ -804,7 +891,7 @@ namespace boost {
                     if (exact_remainder == zero) {
                         if (next_digit < dividend_size) {
                             exact_remainder.digits.clear();
-                            while (dividend[next_digit] == 0 && next_digit < dividend_size) {
+                            while (next_digit < dividend_size && dividend[next_digit] == 0) {
                                 quotient.push_back(0); next_digit++;
                             }
                             if (next_digit == dividend_size) {
@@ -1141,6 +1228,103 @@ namespace boost {
 
             }
 
+            /**
+             * @brief Converts a non negative integer to an unsigned long long.
+             *
+             * @return std::nullopt if the number is negative, has a fractional part or does not
+             * fit in an unsigned long long.
+             */
+            std::optional<unsigned long long> as_unsigned_long_long() const {
+                const unsigned long long base = (std::numeric_limits<T>::max() / 4) * 2;
+                const unsigned long long maximum = std::numeric_limits<unsigned long long>::max();
+                if (std::all_of(digits.cbegin(), digits.cend(), [](T digit) { return digit == 0; })) {
+                    return 0;
+                }
+                if (!positive || (int) digits.size() > exponent) {
+                    return std::nullopt;
+                }
+
+                unsigned long long value = 0;
+                for (int i = 0; i < exponent; ++i) {
+                    unsigned long long digit = (i < (int) digits.size()) ? digits[i] : 0;
+                    if (value > (maximum - digit) / base) {
+                        return std::nullopt;
+                    }
+                    value = value * base + digit;
+                }
+                return value;
+            }
+
+            /**
+             * @brief Computes number^n by left to right sliding window exponentiation. The odd
+             * powers number^1, number^3, ..., number^(2^window - 1) are precomputed, so that every
+             * run of at most window bits of n ending in a set bit costs a single product after
+             * the squarings of its bits. The window grows with the length of n.
+             *
+             * @param round - applied to every square and product, for instance to round them to
+             * a working precision. Exact powers pass them unchanged.
+             */
+            template <typename Round>
+            static exact_number<T> sliding_window_power(const exact_number<T>& number, unsigned long long n, Round round) {
+                exact_number<T> result(std::vector<T> {1}, 1, true);
+                if (n == 0) {
+                    return result;
+                }
+
+                int bits = 0;
+                while (bits < std::numeric_limits<unsigned long long>::digits && (n >> bits) != 0) {
+                    ++bits;
+                }
+                const int window = (bits > 48) ? 5 : (bits > 24) ? 4 : (bits > 8) ? 3 : (bits > 2) ? 2 : 1;
+
+                std::vector<exact_number<T>> odd_powers = {number};
+                if (window > 1) {
+                    exact_number<T> square = number;
+                    square.square();
+                    square = round(std::move(square));
+                    for (size_t i = 1; i < (size_t) 1 << (window - 1); ++i) {
+                        odd_powers.push_back(round(odd_powers.back() * square));
+                    }
+                }
+
+                bool started = false;
+                for (int bit = bits - 1; bit >= 0;) {
+                    if (((n >> bit) & 1) == 0) {
+                        result.square();
+                        result = round(std::move(result));
+                        --bit;
+                        continue;
+                    }
+
+                    // the longest run of at most window bits starting at bit and ending in a set bit
+                    int low = std::max(bit - window + 1, 0);
+                    while (((n >> low) & 1) == 0) {
+                        ++low;
+                    }
+                    unsigned long long run = (n >> low) & ((2ULL << (bit - low)) - 1);
+
+                    if (started) {
+                        for (int i = bit; i >= low; --i) {
+                            result.square();
+                            result = round(std::move(result));
+                        }
+                        result = round(result * odd_powers[run / 2]);
+                    } else {
+                        result = odd_powers[run / 2];
+                        started = true;
+                    }
+                    bit = low - 1;
+                }
+                return result;
+            }
+
+            /**
+             * @brief Computes number^exponent exactly, with sliding_window_power.
+             */
+            static exact_number<T> binary_exponentiation(const exact_number<T>& number, unsigned long long exponent) {
+                return sliding_window_power(number, exponent, [](exact_number<T> &&power) { return std::move(power); });
+            }
+
             /**
              *  @brief:  calculates exact_number^exact_number, (only integral powers)
              *  @param: number: an exact_number whose integral power is to be evaluated
@@ -1151,6 +1335,11 @@ namespace boost {
 
 
             static exact_number<T> binary_exponentiation(const exact_number<T>& number, const exact_number<T>& exponent) {
+                // exponents that fit in 64 bits are scanned with bit tests instead of halving their digits
+                if (std::optional<unsigned long long> machine_exponent = exponent.as_unsigned_long_long()) {
+                    return binary_exponentiation(number, *machine_exponent);
+                }
+
                 exact_number<T> result, zero = exact_number<T> (), number_copy;
                 result.digits = {1};
                 result.exponent = 1;
@@ -1170,7 +1359,7 @@ namespace boost {
                         result = result * number_copy;
                     }
 
-                    number_copy = number_copy * number_copy;
+                    number_copy.square();
 
                     exponent_vector = quotient;
                     if(((int)exponent_vector.size() == 1 && exponent_vector[0] == 0) || exponent_vector.empty()){
@@ -1401,14 +1590,14 @@ namespace boost {
                 
                 // normalizing decimal_part string
                 size_t idx = decimal_part.size();
-                while(decimal_part[idx-1] == '0')
+                while(idx > 0 && decimal_part[idx-1] == '0')
                     idx--;
                 decimal_part = decimal_part.substr(0, idx);
 
                 // if decimal_part is empty then normalize integer_part
                 if(decimal_part.empty()){
                     idx = integer_part.size();
-                    while(integer_part[idx-1] == '0')
+                    while(idx > 0 && integer_part[idx-1] == '0')
                         idx--;
                     integer_part = integer_part.substr(0, idx);
                 }
@@ -1554,7 +1743,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator+(exact_number<T> other) {
+            exact_number<T> operator+(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive == other.positive) {
@@ -1596,7 +1785,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator-(exact_number<T> other) {
+            exact_number<T> operator-(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive != other.positive) {
@@ -1645,7 +1834,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator*(exact_number<T> other) {
+            exact_number<T> operator*(exact_number<T> other) const {
                 exact_number<T> result = *this;
                 result.multiply_vector(other);
                 result.positive = (this->positive == other.positive);
@@ -1667,25 +1856,15 @@ namespace boost {
             /**
              * @brief Generates a string representation of the boost::real::exact_number.
              *
+             * @note To print a given number of digits, in fixed or scientific notation, into a
+             * caller provided buffer, see boost::real::to_chars in real/to_chars.hpp.
+             *
              * @return a string that represents the state of the boost::real::exact_number
              */
             std::string as_string() const {
                 std::string result = "";   
                 exact_number<T> tmp;         
 
-                // If the number is too large, scientific notation is used to print it.
-                /* @TODO add back later
-                if ((this->exponent < -10) || (this->exponent > (int)this->digits.size() + 10)) {
-                    result += "0|.";
-                    for (const auto& d: this->digits) {
-                        result += std::to_string(d);
-                        result += "|";
-                    }
-                    result += "e" + std::to_string(this->exponent);
-                    return result;
-                }
-                */
-
                 if (this->exponent <= 0) {
                     result += ".";
 
@@ -1884,10 +2063,7 @@ namespace boost {
              * normalized representation.
              */
             void normalize() {
-                while (this->digits.size() > 1 && this->digits.front() == 0) {
-                    this->digits.erase(this->digits.cbegin());
-                    this->exponent--;
-                }
+                this->normalize_left();
 
                 while (this->digits.size() > 1 && this->digits.back() == 0) {
                     this->digits.pop_back();
@@ -1905,10 +2081,14 @@ namespace boost {
              * into a semi normalized representation.
              */
             void normalize_left() {
-                while (this->digits.size() > 1 && this->digits.front() == 0) {
-                    this->digits.erase(this->digits.cbegin());
-                    this->exponent--;
+                if (this->digits.size() <= 1 || this->digits.front() != 0) {
+                    return;
                 }
+
+                // the zeros are erased at once, keeping at least one digit
+                auto first_digit = std::find_if(this->digits.cbegin(), this->digits.cend() - 1, [](T digit) { return digit != 0; });
+                this->exponent -= (exponent_t) (first_digit - this->digits.cbegin());
+                this->digits.erase(this->digits.cbegin(), first_digit);
             }
 
             /**
@@ -1938,7 +2118,7 @@ namespace boost {
             }
 
             /// returns an exact_number that has the precision given
-            exact_number<T> up_to(size_t precision, bool upper) {
+            exact_number<T> up_to(size_t precision, bool upper) const {
                 T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                 if (precision >= digits.size())
                     return *this;
@@ -1958,6 +2138,79 @@ namespace boost {
                 return ret;
             }
 
+            /**
+             * @brief Adds delta to *this in place. Only the digits that delta overlaps and the
+             * carry or borrow chain above them are written, so adding a correction that lies far
+             * below the leading digit costs O(delta.size()) instead of a full addition.
+             *
+             * @param delta - the number to add. If its leading digit is not below the leading digit
+             * of *this, the addition falls back to operator+.
+             */
+            void accumulate(const exact_number<T> &delta) {
+                const T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+
+                if (std::all_of(delta.digits.cbegin(), delta.digits.cend(), [](T digit) { return digit == 0; })) {
+                    return;
+                }
+
+                if (this->digits.empty() || this->digits.front() == 0 || delta.digits.front() == 0 || delta.exponent >= this->exponent) {
+                    *this = *this + delta;
+                    return;
+                }
+
+                // |delta| < base^(delta.exponent) <= base^(exponent - 1) <= |*this|, so neither the
+                // sign nor the leading digit position can change by a borrow
+                const size_t offset = this->exponent - delta.exponent;
+                if (this->digits.size() < offset + delta.digits.size()) {
+                    this->digits.resize(offset + delta.digits.size(), 0);
+                }
+
+                if (this->positive == delta.positive) {
+                    T carry = 0;
+                    for (size_t i = delta.digits.size(); i-- > 0;) {
+                        T &digit = this->digits[offset + i];
+                        T sum = digit + delta.digits[i] + carry;
+                        carry = (sum > base) ? 1 : 0;
+                        digit = (carry == 1) ? sum - base - 1 : sum;
+                    }
+                    for (size_t i = offset; carry == 1 && i-- > 0;) {
+                        if (this->digits[i] == base) {
+                            this->digits[i] = 0;
+                        } else {
+                            ++this->digits[i];
+                            carry = 0;
+                        }
+                    }
+                    if (carry == 1) {
+                        this->push_front(1);
+                        ++this->exponent;
+                    }
+                } else {
+                    T borrow = 0;
+                    for (size_t i = delta.digits.size(); i-- > 0;) {
+                        T &digit = this->digits[offset + i];
+                        T subtrahend = delta.digits[i] + borrow;
+                        if (digit >= subtrahend) {
+                            digit -= subtrahend;
+                            borrow = 0;
+                        } else {
+                            digit += (base - subtrahend) + 1;
+                            borrow = 1;
+                        }
+                    }
+                    for (size_t i = offset; borrow == 1 && i-- > 0;) {
+                        if (this->digits[i] == 0) {
+                            this->digits[i] = base;
+                        } else {
+                            --this->digits[i];
+                            borrow = 0;
+                        }
+                    }
+                }
+
+                this->normalize();
+            }
+
             bool is_integral() { 
                 if (exponent < 0) {
                     return false;
@@ -1973,22 +2226,22 @@ namespace boost {
         namespace literals{
 
             template<typename T>
-            const exact_number<T> minus_one_exact = exact_number<T>("-1");
+            const exact_number<T> minus_one_exact = exact_number<T>(std::vector<T> {1}, 1, false);
 
             template<typename T = int>
-            const exact_number<T> zero_exact = exact_number<T>("0");
+            const exact_number<T> zero_exact = exact_number<T>(std::vector<T> {0}, 0, true);
 
             template<typename T>
-            const exact_number<T> one_exact = exact_number<T>("1");
+            const exact_number<T> one_exact = exact_number<T>(std::vector<T> {1}, 1, true);
 
             template<typename T>
-            const exact_number<T> two_exact = exact_number<T>("2");
+            const exact_number<T> two_exact = exact_number<T>(std::vector<T> {2}, 1, true);
 
             template<typename T>
-            const exact_number<T> four_exact = exact_number<T>("4");
+            const exact_number<T> four_exact = exact_number<T>(std::vector<T> {4}, 1, true);
 
             template<typename T>
-            const exact_number<T> eight_exact = exact_number<T>("8");
+            const exact_number<T> eight_exact = exact_number<T>(std::vector<T> {8}, 1, true);
 
         }
 
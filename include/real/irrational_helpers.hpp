@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <real/real.hpp>
+#include <real/constants.hpp>
 #include <math.h>
 #include <limits>
 
@@ -12,6 +13,29 @@ namespace boost {
             // used for extra precision. should be replaced with something more definitive in the future.
             inline const int PLACEHOLDER = 10; 
 
+            /**
+             * @brief Finds the integer that holds the n-th digit of the champernowne number in the
+             * binary integer version. The 2^(k - 1) integers of k binary digits take k 2^(k - 1)
+             * digits, so the block of integers holding n is found in O(log n) steps, and the
+             * integer inside it by a division.
+             *
+             * @param n - The number digit index.
+             * @param integer - Set to the integer holding the digit.
+             * @param length - Set to the number of binary digits of integer.
+             * @return The index of the digit in integer, from its most significant digit.
+             */
+            inline int champernowne_binary_locate(unsigned long long n, unsigned long long &integer, int &length) {
+                length = 1;
+                unsigned long long block = 1;
+                while (n >= block) {
+                    n -= block;
+                    ++length;
+                    block = (unsigned long long) length << (length - 1);
+                }
+                integer = (1ull << (length - 1)) + n / length;
+                return (int) (n % length);
+            }
+
             /**
              * @brief The function returns the n-th digit of the champernowne number in the
              * binary integer version.
@@ -19,123 +43,89 @@ namespace boost {
              * @param n - The number digit index.
              * @return The value of the champernowne number n-th digit (either 0 or 1)
              */
-            int champernowne_binary_get_nth_digit(unsigned int n) {
-                std::vector<int> binary = {1};
-                unsigned int index = 0;
-
-                while (index < n) {
-
-                    if (std::all_of(binary.begin(), binary.end(), [](int d) -> bool { return d == 1; })) {
+            inline int champernowne_binary_get_nth_digit(unsigned int n) {
+                unsigned long long integer;
+                int length;
+                int position = champernowne_binary_locate(n, integer, length);
+                return (int) ((integer >> (length - 1 - position)) & 1);
+            }
 
-                        for (int i = (int)binary.size() - 1; i >= 0; i--) {
-                            binary[i] = 0;
+            /**
+             * @brief Writes the digits start, ..., start + count - 1 of the champernowne number in
+             * the binary integer version to out. The first integer is located in O(log start) and
+             * the following ones are read by counting, so a block costs O(count).
+             */
+            template <typename T = int>
+            void champernowne_binary_digits_block(unsigned int start, unsigned int count, T *out) {
+                unsigned long long integer;
+                int length;
+                int position = champernowne_binary_locate(start, integer, length);
+
+                for (unsigned int i = 0; i < count; ++i) {
+                    out[i] = (T) ((integer >> (length - 1 - position)) & 1);
+                    if (++position == length) {
+                        position = 0;
+                        ++integer;
+                        if ((integer & (integer - 1)) == 0) {
+                            ++length;
                         }
-                        binary.insert(binary.begin(), 1);
-
-                    } else {
+                    }
+                }
+            }
 
-                        for (int i = (int)binary.size() - 1; i >= 0; i--) {
-                            if (binary[i] == 0) {
-                                for (int j = (int)binary.size() - 1; j > i; j--) {
-                                    binary[j] = 0;
-                                }
-                                binary[i] = 1;
-                                break;
-                            }
+            /**
+             * @brief Streams the digits of the champernowne number in the binary integer version.
+             * The integer whose digits are being read is kept from a call to the next, so that
+             * consecutive digits cost O(1). Asking for any other digit locates it again (see
+             * champernowne_binary_locate).
+             */
+            class champernowne_binary_digits {
+                unsigned long long _integer = 1;
+                int _length = 1;     // the number of binary digits of _integer
+                int _position = 0;   // the digit of _integer that is the _next digit of the number
+                unsigned int _next = 0;
+
+                void advance() {
+                    if (++_position == _length) {
+                        _position = 0;
+                        ++_integer;
+                        if ((_integer & (_integer - 1)) == 0) {
+                            ++_length;
                         }
                     }
-
-                    index += binary.size();
+                    ++_next;
                 }
 
-                return binary[binary.size() - 1 - (index - n)];
-            }
+                public:
+                int operator()(unsigned int n) {
+                    if (n != _next) {
+                        _position = champernowne_binary_locate(n, _integer, _length);
+                        _next = n;
+                    }
+                    int digit = (int) ((_integer >> (_length - 1 - _position)) & 1);
+                    advance();
+                    return digit;
+                }
+            };
 
 
-            /// @TODO: figure out how to avoid unnecessary recalculation by saving
-            // some information from the previous iteration.
+            /// the digits of a constant of boost::real::constants::shared() as a block function
+            template <typename T, CONSTANT constant>
+            void constant_digits(unsigned int start, unsigned int count, T *out) {
+                constants<T>::shared().get_digits(constant, start, count, out);
+            }
 
+            /// the digits of pi as a block function, from the Chudnovsky series (see boost::real::constants)
+            template <typename T = int>
+            void pi_digits(unsigned int start, unsigned int count, T *out) {
+                constant_digits<T, CONSTANT::PI>(start, count, out);
+            }
 
             template <typename T = int>
             T pi_nth_digit(unsigned int n) {
-                // Chudnovsky Algorithm
-                // pi = C * ( sum_from_k=0_to_k=x (Mk * Lk / Xk) )^(-1) 
-                // increasing x you get more precise pi
-
-                static const boost::real::real_explicit<T> real_k("6");
-                static const boost::real::real_explicit<T> real_m("1");
-                static const boost::real::real_explicit<T> real_l("13591409");
-                static const boost::real::real_explicit<T> real_l0("545140134");
-                static const boost::real::real_explicit<T> real_x("1");
-                static const boost::real::real_explicit<T> real_x0("-262537412640768000");
-                static const boost::real::real_explicit<T> real_s("13591409");
-
-                // real_c is constant C in the above formula
-                // its actual value is C = 426880 * sqrt(10005)
-                // following approximation for C can be removed 
-                // once the square root function is implemented
-                static const boost::real::real<T> real_c("42698670.6663333958177128891606596082733208840025090828008380071788526051574575942163017999114556686013457371674940804113922927361812667281931368821705825634600667987664834607957359835523339854848545832762473774912507545850325782197456759912124003920153233212768354462964858373556973060121234587580491432166");
-
-                exact_number<T> K = real_k.get_exact_number();
-                exact_number<T> L = real_l.get_exact_number();
-                exact_number<T> M = real_m.get_exact_number();
-                exact_number<T> X = real_x.get_exact_number();
-                exact_number<T> S = real_s.get_exact_number();
-
-                static exact_number<T> L0 = real_l0.get_exact_number();
-                static exact_number<T> X0 = real_x0.get_exact_number();
-                static exact_number<T> _16(std::vector<T> {16}, 1, true);
-                static exact_number<T> _12(std::vector<T> {12}, 1, true);
-                static exact_number<T> one("1");
-
-                static boost::real::const_precision_iterator<T> real_c_itr = real_c.get_real_itr();
-                real_c_itr.set_maximum_precision(n + 1);
-                const exact_number<T> C = real_c_itr.cend().get_interval().lower_bound;
-
-
-                bool nth_digit_found = false;
-                bool first_iteration_over = false;
-
-                exact_number<T> iteration_number = one;
-                exact_number<T> prev_pi;
-                exact_number<T> pi;
-                exact_number<T> error;
-                const exact_number<T> max_error(std::vector<T> {1}, -(n + 1), true);
-
-                do {  
-                    exact_number<T> temp = K * K * K - _16 * K;
-                    temp.divide_vector(iteration_number * iteration_number * iteration_number, n + 1, true);
-                    M *= temp;
-                    X *= X0;
-                    L += L0;
-                    K += _12;
-
-                    temp = M * L;
-                    temp.divide_vector(X, n + 1, false);
-                    S += temp;
-
-                    temp = C;
-                    temp.divide_vector(S, n + 1, false);
-
-                    pi = temp;
-                    if (!first_iteration_over) {
-                        prev_pi = pi;
-                        first_iteration_over = true;
-                        iteration_number += one;
-                    } else {
-                        error = pi - prev_pi;
-                        error.positive = true;
-
-                        if (error < max_error) {
-                            nth_digit_found = true;
-                        }
-                        iteration_number += one;
-                        prev_pi = pi;
-                    }
-
-                } while (!nth_digit_found);
-
-                return pi[n];
+                T digit;
+                pi_digits<T>(n, 1, &digit);
+                return digit;
             }
         }
     }
@@ -12,12 +12,33 @@ namespace boost {
             /**
              * @brief The Champernowne is a transcendental real constant whose digits are formed by
              * consecutively concatenated representations of sucessive integers in a determined base.
-             * In this function, a binary base is used.
+             * In this function, a binary base is used. Its digits are computed in blocks, each starting
+             * from the integer located in O(log n) (see champernowne_binary_locate).
              */
-            boost::real::real CHAMPERNOWNE_BINARY(boost::real::irrational::champernowne_binary_get_nth_digit, 0);
+            boost::real::real CHAMPERNOWNE_BINARY(boost::real::irrational::champernowne_binary_digits_block<int>, 0);
 
+            /**
+             * @brief The number pi, whose digits are computed in blocks by the Chudnovsky series
+             * (see boost::real::constants), shared by the whole process.
+             */
+            template <typename T = int>
+            boost::real::real<T> PI(boost::real::irrational::pi_digits<T>, 1);
+
+            /// The number e, from the series of 1 / k! (see boost::real::constants)
+            template <typename T = int>
+            boost::real::real<T> E(boost::real::irrational::constant_digits<T, CONSTANT::E>, 1);
+
+            /// The natural logarithm of 2, from the series of atanh(1 / 3) (see boost::real::constants)
+            template <typename T = int>
+            boost::real::real<T> LN2(boost::real::irrational::constant_digits<T, CONSTANT::LN2>, 0);
+
+            /// The natural logarithm of 10 (see boost::real::constants)
+            template <typename T = int>
+            boost::real::real<T> LN10(boost::real::irrational::constant_digits<T, CONSTANT::LN10>, 1);
+
+            /// The square root of 2, by Newton steps (see boost::real::constants)
             template <typename T = int>
-            boost::real::real<T> PI(boost::real::irrational::pi_nth_digit<T>, 1);
+            boost::real::real<T> SQRT2(boost::real::irrational::constant_digits<T, CONSTANT::SQRT2>, 1);
         }
     }
 }
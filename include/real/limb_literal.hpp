@@ -0,0 +1,413 @@
+#ifndef BOOST_REAL_LIMB_LITERAL_HPP
+#define BOOST_REAL_LIMB_LITERAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <real/real_exception.hpp>
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+        namespace detail {
+
+            /**
+             * @brief A decimal number already converted to the internal limb base of T.
+             *
+             * An integral number is stored in the numerator only. A number with a fractional part
+             * is stored as numerator / denominator, where the denominator is a power of ten, which is
+             * the same representation the boost::real::real string constructor builds at runtime.
+             * Both are stored as real_explicit does: limbs most significant first, trailing zero
+             * limbs removed and the exponent counting the number of limbs of the integer.
+             *
+             * All the members are constexpr, so a literal can be converted once at compile time and
+             * only copied into its std::vector at runtime.
+             */
+            template <typename T, std::size_t N>
+            struct limb_literal {
+                std::array<T, N> numerator_digits{};
+                std::size_t numerator_size = 0;
+                int numerator_exponent = 0;
+
+                std::array<T, N> denominator_digits{};
+                std::size_t denominator_size = 0;
+                int denominator_exponent = 0;
+
+                bool positive = true;
+
+                constexpr bool is_integral() const {
+                    return denominator_size == 0;
+                }
+
+                exact_number<T> numerator() const {
+                    return exact_number<T>(std::vector<T>(numerator_digits.begin(), numerator_digits.begin() + numerator_size),
+                                           numerator_exponent, positive);
+                }
+
+                exact_number<T> denominator() const {
+                    return exact_number<T>(std::vector<T>(denominator_digits.begin(), denominator_digits.begin() + denominator_size),
+                                           denominator_exponent, true);
+                }
+            };
+
+            /// the radix of the limbs of exact_number<T>
+            template <typename T>
+            constexpr T limb_base() {
+                return (std::numeric_limits<T>::max() / 4) * 2;
+            }
+
+            /// number of decimal digits that always fit in a single limb
+            template <typename T>
+            constexpr std::size_t decimal_digits_per_limb() {
+                std::size_t digits = 0;
+                for (T power = 1; power <= limb_base<T>() / 10; power *= 10) {
+                    ++digits;
+                }
+                return digits;
+            }
+
+            /**
+             * @brief Result of scanning a decimal literal: the value is
+             * sign * (significant digits in [first, last]) * 10^decimal_exponent
+             */
+            struct decimal_scan {
+                bool positive = true;
+                bool zero = true;
+                std::size_t first = 0;
+                std::size_t last = 0;
+                std::size_t significant_digits = 0;
+                long decimal_exponent = 0;
+            };
+
+            /**
+             * @brief Splits a literal of the form [+-]digits[.digits][(e|E)[+-]digits] without
+             * allocating. Digit separators (') are skipped.
+             *
+             * @throws boost::real::invalid_string_number_exception if the literal is malformed.
+             * @throws boost::real::exponent_overflow_exception if the exponent does not fit in an int.
+             */
+            constexpr decimal_scan scan_decimal_literal(const char* number, std::size_t length) {
+                decimal_scan scan;
+                std::size_t index = 0;
+
+                if (index < length && (number[index] == '-' || number[index] == '+')) {
+                    scan.positive = number[index] == '+';
+                    ++index;
+                }
+
+                bool has_digit = false;
+                bool has_decimal = false;
+                long fractional_digits = 0;
+                long trailing_zeros = 0;
+                std::size_t last_nonzero_ordinal = 0;
+                std::size_t ordinal = 0;
+
+                for (; index < length && number[index] != 'e' && number[index] != 'E'; ++index) {
+                    char c = number[index];
+                    if (c == '\'') {
+                        continue;
+                    }
+                    if (c == '.') {
+                        if (has_decimal) {
+                            throw invalid_string_number_exception();
+                        }
+                        has_decimal = true;
+                        continue;
+                    }
+                    if (c < '0' || c > '9') {
+                        throw invalid_string_number_exception();
+                    }
+
+                    has_digit = true;
+                    if (has_decimal) {
+                        ++fractional_digits;
+                    }
+                    if (c != '0') {
+                        if (scan.zero) {
+                            scan.zero = false;
+                            scan.first = index;
+                            scan.significant_digits = 0;
+                        } else {
+                            scan.significant_digits += ordinal - last_nonzero_ordinal - 1;
+                        }
+                        ++scan.significant_digits;
+                        scan.last = index;
+                        last_nonzero_ordinal = ordinal;
+                        trailing_zeros = 0;
+                    } else if (!scan.zero) {
+                        ++trailing_zeros;
+                    }
+                    ++ordinal;
+                }
+
+                if (!has_digit) {
+                    throw invalid_string_number_exception();
+                }
+
+                long exponent = 0;
+                if (index < length) {
+                    ++index; // skip 'e'
+                    bool exponent_positive = true;
+                    if (index < length && (number[index] == '-' || number[index] == '+')) {
+                        exponent_positive = number[index] == '+';
+                        ++index;
+                    }
+                    if (index == length) {
+                        throw invalid_string_number_exception();
+                    }
+                    for (; index < length; ++index) {
+                        char c = number[index];
+                        if (c == '\'') {
+                            continue;
+                        }
+                        if (c < '0' || c > '9') {
+                            throw invalid_string_number_exception();
+                        }
+                        exponent = exponent * 10 + (c - '0');
+                        if (exponent > std::numeric_limits<int>::max()) {
+                            throw exponent_overflow_exception();
+                        }
+                    }
+                    if (!exponent_positive) {
+                        exponent = -exponent;
+                    }
+                }
+
+                scan.decimal_exponent = exponent - fractional_digits + trailing_zeros;
+                if (scan.zero) {
+                    scan.positive = true;
+                    scan.decimal_exponent = 0;
+                }
+                return scan;
+            }
+
+            /**
+             * @brief Number of limbs a limb_literal needs to hold the given decimal literal.
+             * Meant to be used as the capacity template argument of parse_limb_literal.
+             */
+            template <typename T>
+            constexpr std::size_t limb_literal_capacity(const char* number, std::size_t length) {
+                decimal_scan scan = scan_decimal_literal(number, length);
+                if (scan.zero) {
+                    return 1;
+                }
+
+                std::size_t numerator_digits = scan.significant_digits;
+                std::size_t denominator_digits = 1;
+                if (scan.decimal_exponent > 0) {
+                    numerator_digits += scan.decimal_exponent;
+                } else {
+                    denominator_digits += -scan.decimal_exponent;
+                }
+
+                std::size_t decimal_digits = std::max(numerator_digits, denominator_digits);
+                return decimal_digits / decimal_digits_per_limb<T>() + 1;
+            }
+
+            /**
+             * @brief limbs = limbs * radix + digit, where limbs is a little endian vector of
+             * size limbs and digit < radix <= 16. It only adds and compares, so it works for
+             * every T and does not depend on a wider integral type.
+             */
+            template <typename T, std::size_t N>
+            constexpr void multiply_and_add(std::array<T, N>& limbs, std::size_t& size, unsigned radix, T digit) {
+                constexpr T base = limb_base<T>();
+                T carry = digit;
+
+                for (std::size_t i = 0; i < size; ++i) {
+                    T value = carry;
+                    T overflow = 0;
+                    for (unsigned k = 0; k < radix; ++k) {
+                        if (value >= base - limbs[i]) {
+                            value -= base - limbs[i];
+                            ++overflow;
+                        } else {
+                            value += limbs[i];
+                        }
+                    }
+                    limbs[i] = value;
+                    carry = overflow;
+                }
+
+                if (carry != 0) {
+                    if (size == N) {
+                        throw limb_literal_overflow_exception();
+                    }
+                    limbs[size++] = carry;
+                }
+            }
+
+            /// limbs = limbs * 10 + digit, see multiply_and_add
+            template <typename T, std::size_t N>
+            constexpr void multiply_by_ten_and_add(std::array<T, N>& limbs, std::size_t& size, T digit) {
+                multiply_and_add(limbs, size, 10, digit);
+            }
+
+            /**
+             * @brief Moves the little endian limbs into digits most significant first, dropping the
+             * trailing zero limbs as real_explicit does. Returns the exponent of the number.
+             */
+            template <typename T, std::size_t N>
+            constexpr int normalize_limbs(const std::array<T, N>& limbs, std::size_t size,
+                                          std::array<T, N>& digits, std::size_t& digits_size) {
+                std::size_t zeros = 0;
+                while (zeros + 1 < size && limbs[zeros] == 0) {
+                    ++zeros;
+                }
+
+                digits_size = 0;
+                for (std::size_t i = size; i > zeros; --i) {
+                    digits[digits_size++] = limbs[i - 1];
+                }
+                return (int) size;
+            }
+
+            /**
+             * @brief Converts a decimal literal to limbs. When called in a constant expression,
+             * the whole base conversion happens at compile time.
+             *
+             * @tparam N - the limb capacity, see limb_literal_capacity.
+             * @throws boost::real::limb_literal_overflow_exception if the literal needs more than N limbs.
+             */
+            template <typename T, std::size_t N>
+            constexpr limb_literal<T, N> parse_limb_literal(const char* number, std::size_t length) {
+                limb_literal<T, N> literal;
+                decimal_scan scan = scan_decimal_literal(number, length);
+
+                literal.positive = scan.positive;
+                if (scan.zero) {
+                    literal.numerator_size = 1;
+                    literal.numerator_exponent = 0;
+                    return literal;
+                }
+
+                std::array<T, N> limbs{};
+                std::size_t size = 0;
+                for (std::size_t i = scan.first; i <= scan.last; ++i) {
+                    if (number[i] >= '0' && number[i] <= '9') {
+                        multiply_by_ten_and_add(limbs, size, (T) (number[i] - '0'));
+                    }
+                }
+                for (long i = 0; i < scan.decimal_exponent; ++i) {
+                    multiply_by_ten_and_add(limbs, size, (T) 0);
+                }
+                literal.numerator_exponent = normalize_limbs(limbs, size, literal.numerator_digits, literal.numerator_size);
+
+                if (scan.decimal_exponent < 0) {
+                    std::array<T, N> power{};
+                    std::size_t power_size = 0;
+                    multiply_by_ten_and_add(power, power_size, (T) 1);
+                    for (long i = 0; i < -scan.decimal_exponent; ++i) {
+                        multiply_by_ten_and_add(power, power_size, (T) 0);
+                    }
+                    literal.denominator_exponent = normalize_limbs(power, power_size, literal.denominator_digits, literal.denominator_size);
+                }
+
+                return literal;
+            }
+
+            /**
+             * @brief The radix of an integer literal as the compiler reads it: 16 after 0x, 2 after
+             * 0b, 8 for the other integers starting with 0, and 10 for everything else, including
+             * the floating literals.
+             */
+            constexpr unsigned literal_radix(const char* number, std::size_t length) {
+                if (length < 2 || number[0] != '0') {
+                    return 10;
+                }
+                if (number[1] == 'x' || number[1] == 'X') {
+                    return 16;
+                }
+                if (number[1] == 'b' || number[1] == 'B') {
+                    return 2;
+                }
+                for (std::size_t i = 1; i < length; ++i) {
+                    if (number[i] == '.' || number[i] == 'e' || number[i] == 'E') {
+                        return 10;
+                    }
+                }
+                return 8;
+            }
+
+            /// whether a literal starting with 0x is a hexadecimal floating literal, such as 0x1.8p3
+            constexpr bool is_hexadecimal_floating_literal(const char* number, std::size_t length) {
+                for (std::size_t i = 2; i < length; ++i) {
+                    if (number[i] == '.' || number[i] == 'p' || number[i] == 'P') {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /// number of limbs a limb_literal needs to hold an integer literal of the given radix
+            template <typename T>
+            constexpr std::size_t integer_literal_capacity(std::size_t length, unsigned radix) {
+                // a digit of the radix takes at most 4 bits, a limb holds at least 3 bits per decimal digit
+                const std::size_t bits = (radix == 16) ? 4 : (radix == 8) ? 3 : 1;
+                return length * bits / (3 * decimal_digits_per_limb<T>()) + 1;
+            }
+
+            /**
+             * @brief Converts an integer literal in radix 16 (0x...), 8 (0...) or 2 (0b...) to limbs.
+             * Digit separators (') are skipped.
+             *
+             * @throws boost::real::invalid_string_number_exception if a digit is not one of the radix.
+             * @throws boost::real::limb_literal_overflow_exception if the literal needs more than N limbs.
+             */
+            template <typename T, std::size_t N>
+            constexpr limb_literal<T, N> parse_integer_limb_literal(const char* number, std::size_t length, unsigned radix) {
+                limb_literal<T, N> literal;
+                std::array<T, N> limbs{};
+                std::size_t size = 0;
+                bool has_digit = false;
+
+                for (std::size_t i = (radix == 8) ? 1 : 2; i < length; ++i) {
+                    char c = number[i];
+                    if (c == '\'') {
+                        continue;
+                    }
+                    unsigned digit = radix;
+                    if (c >= '0' && c <= '9') {
+                        digit = (unsigned) (c - '0');
+                    } else if (c >= 'a' && c <= 'f') {
+                        digit = (unsigned) (c - 'a') + 10;
+                    } else if (c >= 'A' && c <= 'F') {
+                        digit = (unsigned) (c - 'A') + 10;
+                    }
+                    if (digit >= radix) {
+                        throw invalid_string_number_exception();
+                    }
+                    has_digit = true;
+                    if (size != 0 || digit != 0) {
+                        multiply_and_add(limbs, size, radix, (T) digit);
+                    }
+                }
+                if (!has_digit && radix != 8) {
+                    throw invalid_string_number_exception();
+                }
+
+                if (size == 0) {
+                    literal.numerator_size = 1;
+                    return literal;
+                }
+                literal.numerator_exponent = normalize_limbs(limbs, size, literal.numerator_digits, literal.numerator_size);
+                return literal;
+            }
+
+            /**
+             * @brief Converts a string literal to limbs, with a capacity of one limb per character.
+             * That holds any literal whose decimal exponent keeps the number within
+             * decimal_digits_per_limb<T>() * N digits, a larger one fails to compile.
+             */
+            template <typename T, std::size_t N>
+            constexpr limb_literal<T, N> make_limb_literal(const char (&number)[N]) {
+                return parse_limb_literal<T, N>(number, N - 1);
+            }
+        }
+    }
+}
+
+#endif //BOOST_REAL_LIMB_LITERAL_HPP
@@ -1,9 +1,39 @@
+#ifndef BOOST_REAL_LITERALS_HPP
+#define BOOST_REAL_LITERALS_HPP
+
 #include <real/real.hpp>
 #include <real/exact_number.hpp>
+#include <real/limb_literal.hpp>
 
 namespace boost{
 	namespace real{
 		namespace literals{
+			/**
+			 * Limb form of the constants below, converted from decimal at compile time.
+			 **/
+			namespace limbs {
+				template<typename T>
+				constexpr auto mass_of_electron = detail::make_limb_literal<T>("0.000548579909067");
+
+				template<typename T>
+				constexpr auto mass_of_proton = detail::make_limb_literal<T>("1.007276466583");
+
+				template<typename T>
+				constexpr auto mass_of_deuteron = detail::make_limb_literal<T>("2.01355321280");
+
+				template<typename T>
+				constexpr auto mass_of_neutron = detail::make_limb_literal<T>("1.00866491580");
+
+				template<typename T>
+				constexpr auto planck_constant = detail::make_limb_literal<T>("6.62607015e-34");
+
+				template<typename T>
+				constexpr auto gravitation_constant = detail::make_limb_literal<T>("6.67430e-11");
+
+				template<typename T>
+				constexpr auto boltzmann_constant = detail::make_limb_literal<T>("1.380649e-23");
+			}
+
 			/**
 			 * Mass of electrong (in atomic mass unit) : 0.000548579909070 atomic mass unit
 			 * Reference: 
@@ -13,7 +43,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> mass_of_electron = real<T>("0.000548579909067");
+			const real<T> mass_of_electron = real<T>(limbs::mass_of_electron<T>);
 
 			/**
 			 * Mass of proton (in atomic mass unit) : 1.007276466583 atomic mass unit
@@ -25,7 +55,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> mass_of_proton = real<T>("1.007276466583");
+			const real<T> mass_of_proton = real<T>(limbs::mass_of_proton<T>);
 
 			/**
 			 * Mass of deuteron (in atomic mass unit) : 2.01355321280 atomic mass unit
@@ -35,7 +65,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> mass_of_deuteron = real<T>("2.01355321280");
+			const real<T> mass_of_deuteron = real<T>(limbs::mass_of_deuteron<T>);
 
 			
 			/**
@@ -46,7 +76,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> mass_of_neutron = real<T>("1.00866491580");
+			const real<T> mass_of_neutron = real<T>(limbs::mass_of_neutron<T>);
 
 			/**
 			 * Speed of Light (in metres per second) : 299792458 m/s
@@ -65,7 +95,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> planck_constant = real<T>("6.62607015e-34");
+			const real<T> planck_constant = real<T>(limbs::planck_constant<T>);
 
 			/**
 			 * @brief Gravitation Constant : 6.67430 * 10^(-11) m3 / (Kg * s2) (cubic metre per kilogram per square seconds) with 
@@ -74,7 +104,7 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> gravitation_constant = real<T>("6.67430e-11");
+			const real<T> gravitation_constant = real<T>(limbs::gravitation_constant<T>);
 
 
 			/**
@@ -83,8 +113,10 @@ namespace boost{
 			 **/
 
 			template<typename T>
-			const real<T> boltzmann_constant = real<T>("1.380649e-23");
+			const real<T> boltzmann_constant = real<T>(limbs::boltzmann_constant<T>);
 
 		}
 	}
-}
\ No newline at end of file
+}
+
+#endif //BOOST_REAL_LITERALS_HPP
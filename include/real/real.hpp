@@ -1,6 +1,7 @@
 #ifndef BOOST_REAL_HPP
 #define BOOST_REAL_HPP
 
+#include <atomic>
 #include <iostream>
 #include <optional>
 #include <vector>
@@ -12,6 +13,7 @@
 #include <variant>
 
 #include <real/real_exception.hpp>
+#include <real/limb_literal.hpp>
 #include <real/real_explicit.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_operation.hpp>
@@ -73,7 +75,256 @@ namespace boost {
             // ctor from shared_ptr to (already init) real_data. used in check_and_distribute.
             real(std::shared_ptr<real_data<T>> x) : _real_p(x){};
 
+            /**
+             * @brief Refines both iterators following the const_precision_iterator comparison_schedule
+             * until decide returns a result, at most up to one digit beyond maximum_precision. The
+             * iterators may already be refined by previous comparisons, in which case their current
+             * intervals are tried first and the schedule continues from the lowest of both precisions.
+             *
+             * Both iterators may be shared with comparisons running on other threads, so the
+             * intervals are decided on copies (see const_precision_iterator::interval_snapshot).
+             *
+             * @param decide - a function of both intervals that returns the result of the comparison,
+             * or std::nullopt if the intervals do not decide it yet.
+             * @throws boost::real::precision_exception if the maximum precision is reached undecided.
+             */
+            template <typename F>
+            static bool compare(const_precision_iterator<T>& lhs, const_precision_iterator<T>& rhs,
+                                precision_t maximum_precision, F decide) {
+                precision_schedule schedule(const_precision_iterator<T>::comparison_schedule);
+                precision_t last_precision = maximum_precision + 1;
+
+                // explicit numbers stop at their number of digits, so the precision the comparison
+                // reached is tracked here rather than taken from the iterators
+                precision_t precision = std::min(lhs.get_precision(), rhs.get_precision());
+
+                while (true) {
+                    // the first interval of some operations (sin, cos...) is not an enclosure yet
+                    if (precision > 1) {
+                        std::optional<bool> result = decide(lhs.interval_snapshot(), rhs.interval_snapshot());
+                        if (result) {
+                            return *result;
+                        }
+                    }
+
+                    if (precision >= last_precision) {
+                        // If the precision is reached and the number ranges still overlap, then we cannot
+                        // know the result and we throw an error.
+                        throw boost::real::precision_exception();
+                    }
+
+                    precision_t next = schedule.next();
+                    while (next <= precision) {
+                        next = schedule.next();
+                    }
+                    next = std::min(next, last_precision);
+
+                    // lhs and rhs are the same iterator when a number is compared against itself
+                    if (lhs.get_precision() < next) {
+                        lhs.iterate_n_times(next - lhs.get_precision());
+                    }
+                    if (rhs.get_precision() < next) {
+                        rhs.iterate_n_times(next - rhs.get_precision());
+                    }
+                    precision = next;
+                }
+            }
+
+            static std::optional<bool> less_than(const interval<T>& lhs, const interval<T>& rhs) {
+                if (lhs.is_a_number() && rhs.is_a_number()) {
+                    return lhs < rhs;
+                }
+                if (lhs < rhs) {
+                    return true;
+                }
+                if (rhs < lhs) {
+                    return false;
+                }
+                return std::nullopt;
+            }
+
+            static std::optional<bool> greater_than(const interval<T>& lhs, const interval<T>& rhs) {
+                if (lhs.is_a_number() && rhs.is_a_number()) {
+                    return lhs > rhs;
+                }
+                if (lhs > rhs) {
+                    return true;
+                }
+                if (rhs > lhs) {
+                    return false;
+                }
+                return std::nullopt;
+            }
+
+            static std::optional<bool> equal(const interval<T>& lhs, const interval<T>& rhs) {
+                if (lhs.is_a_number() && rhs.is_a_number()) {
+                    return lhs == rhs;
+                }
+                if (lhs < rhs || rhs < lhs) {
+                    return false;
+                }
+                return std::nullopt;
+            }
+
+            /**
+             * @brief Sets this number to this + other (op is SUM) or this * other (op is PRODUCT)
+             * when it already is a sum or an addition (a product or a multiplication), by making
+             * other one more operand of it, so that chains of += and *= build a single n-ary node
+             * instead of a binary tree as deep as the chain. The node is extended in place when
+             * nothing else refers to it, and copied otherwise.
+             *
+             * @return false, leaving this number unchanged, if it is not such an operation or other
+             * is a rational number, which += and *= handle themselves.
+             */
+            bool extend(real<T> &other, OPERATION op) {
+                const OPERATION binary = (op == OPERATION::SUM) ? OPERATION::ADDITION : OPERATION::MULTIPLICATION;
+                auto operation = std::get_if<real_operation<T>>(_real_p->get_real_ptr());
+                if (operation == nullptr || std::holds_alternative<real_rational<T>>(other._real_p->get_real_number()) ||
+                    (operation->get_operation() != op && operation->get_operation() != binary)) {
+                    return false;
+                }
+
+                if (_real_p.use_count() == 1 && _real_p->push_operand(other._real_p, op)) {
+                    return true;
+                }
+
+                std::vector<std::shared_ptr<real_data<T>>> operands;
+                if (operation->get_operation() == op) {
+                    operands.reserve(operation->operand_count() + 1);
+                    operands.insert(operands.end(), operation->operands().cbegin(), operation->operands().cend());
+                } else {
+                    operands = {operation->lhs(), operation->rhs()};
+                }
+                operands.push_back(other._real_p);
+                _real_p = std::make_shared<real_data<T>>(real_operation<T>(std::move(operands), op));
+                return true;
+            }
+
+            /// an exactly known value, as a numerator and a denominator
+            using fraction = std::pair<exact_number<T>, exact_number<T>>;
+
+            /**
+             * @return the value of number as a fraction when it is exactly known: an explicit
+             * number, a rational number, or the division of two explicit numbers, which is how
+             * the string constructor represents decimal numbers. std::nullopt otherwise.
+             */
+            static std::optional<fraction> exact_fraction(const real_number<T>& number) {
+                if (auto explicit_number = std::get_if<real_explicit<T>>(&number)) {
+                    return fraction(explicit_number->get_exact_number(), literals::one_exact<T>);
+                }
+                if (auto rational_number = std::get_if<real_rational<T>>(&number)) {
+                    return fraction(real_explicit<T>(rational_number->a).get_exact_number(),
+                                    real_explicit<T>(rational_number->b).get_exact_number());
+                }
+                auto operation = std::get_if<real_operation<T>>(&number);
+                if (operation == nullptr || operation->get_operation() != OPERATION::DIVISION) {
+                    return std::nullopt;
+                }
+                auto numerator = std::get_if<real_explicit<T>>(&operation->lhs()->get_real_number());
+                auto denominator = std::get_if<real_explicit<T>>(&operation->rhs()->get_real_number());
+                if (numerator == nullptr || denominator == nullptr) {
+                    return std::nullopt;
+                }
+                return fraction(numerator->get_exact_number(), denominator->get_exact_number());
+            }
+
+            /// an upper bound of the digits of lhs * rhs
+            static long long product_digits(const exact_number<T>& lhs, const exact_number<T>& rhs) {
+                return (long long) lhs.digits.size() + (long long) rhs.digits.size();
+            }
+
+            /// an upper bound of the digits of lhs + rhs and lhs - rhs
+            static long long sum_digits(const exact_number<T>& lhs, const exact_number<T>& rhs) {
+                long long most = std::max(lhs.exponent, rhs.exponent);
+                long long least = std::min((long long) lhs.exponent - (long long) lhs.digits.size(),
+                                           (long long) rhs.exponent - (long long) rhs.digits.size());
+                return most - least + 1;
+            }
+
+            static real<T> explicit_of(exact_number<T> number) {
+                number.normalize();
+                if (number.digits.empty()) {
+                    number = literals::zero_exact<T>;
+                }
+                return real<T>(std::make_shared<real_data<T>>(real_explicit<T>(std::move(number))));
+            }
+
+            /**
+             * @brief Computes this + other, this - other or this * other (op is ADDITION,
+             * SUBTRACTION or MULTIPLICATION) when both numbers are exactly known (see
+             * exact_fraction) and not both rational, as rational numbers have their own exact
+             * operators. The result is an explicit number, or the division of two explicit
+             * numbers if it is not an integer fraction, so that operations between literals do
+             * not build operation nodes to be refined digit by digit.
+             *
+             * @return the result, or std::nullopt if the operation has to be built, also when the
+             * numerator or the denominator of the result would have more than
+             * constant_folding_limit digits.
+             */
+            std::optional<real<T>> fold(const real<T>& other, OPERATION op) const {
+                const real_number<T> &lhs_number = _real_p->get_real_number();
+                const real_number<T> &rhs_number = other._real_p->get_real_number();
+                const size_t folding_limit = constant_folding_limit;
+                if (folding_limit == 0 ||
+                    (std::holds_alternative<real_rational<T>>(lhs_number) && std::holds_alternative<real_rational<T>>(rhs_number))) {
+                    return std::nullopt;
+                }
+
+                std::optional<fraction> lhs = exact_fraction(lhs_number);
+                std::optional<fraction> rhs = exact_fraction(rhs_number);
+                if (!lhs || !rhs) {
+                    return std::nullopt;
+                }
+                auto &[lhs_numerator, lhs_denominator] = *lhs;
+                auto &[rhs_numerator, rhs_denominator] = *rhs;
+
+                // the numerator and denominator are bounded before computing them
+                const bool same_denominator = (op != OPERATION::MULTIPLICATION) && lhs_denominator == rhs_denominator;
+                long long digits;
+                if (op == OPERATION::MULTIPLICATION) {
+                    digits = std::max(product_digits(lhs_numerator, rhs_numerator), product_digits(lhs_denominator, rhs_denominator));
+                } else if (same_denominator) {
+                    digits = std::max(sum_digits(lhs_numerator, rhs_numerator), (long long) lhs_denominator.digits.size());
+                } else {
+                    digits = std::max(product_digits(lhs_numerator, rhs_denominator), product_digits(rhs_numerator, lhs_denominator)) + 1;
+                    digits = std::max(digits, product_digits(lhs_denominator, rhs_denominator));
+                }
+                if (digits > (long long) folding_limit) {
+                    return std::nullopt;
+                }
+
+                exact_number<T> numerator;
+                exact_number<T> denominator;
+                if (op == OPERATION::MULTIPLICATION) {
+                    numerator = lhs_numerator * rhs_numerator;
+                    denominator = lhs_denominator * rhs_denominator;
+                } else {
+                    if (!same_denominator) {
+                        lhs_numerator = lhs_numerator * rhs_denominator;
+                        rhs_numerator = rhs_numerator * lhs_denominator;
+                        lhs_denominator = lhs_denominator * rhs_denominator;
+                    }
+                    numerator = (op == OPERATION::ADDITION) ? lhs_numerator + rhs_numerator : lhs_numerator - rhs_numerator;
+                    denominator = std::move(lhs_denominator);
+                }
+
+                if (denominator == literals::one_exact<T>) {
+                    return explicit_of(std::move(numerator));
+                }
+                std::shared_ptr<real_data<T>> numerator_p = explicit_of(std::move(numerator))._real_p;
+                std::shared_ptr<real_data<T>> denominator_p = explicit_of(std::move(denominator))._real_p;
+                return real<T>(real_operation<T>(numerator_p, denominator_p, OPERATION::DIVISION));
+            }
+
         public:
+            /**
+             * @brief The maximum number of digits of a sum, difference or product of exactly
+             * representable numbers computed when the operation is built (see fold). Larger
+             * results are represented as operations. 0 disables the folding. It is atomic as
+             * every sum, difference and product reads it.
+             */
+            inline static std::atomic<size_t> constant_folding_limit{256};
+
             /// @TODO: Move constructors to move directly from the ctors in real_explicit to the values in real_data
             /// @TODO: do we need different ctors to be more efficient? rvalue AND lvalue ref?
 
@@ -176,6 +427,24 @@ namespace boost {
         }
 
 
+            /**
+             * @brief Limb literal constructor. Builds the same number as the string constructor,
+             * from a literal whose base conversion was already done, usually at compile time.
+             *
+             * @param literal - a boost::real::detail::limb_literal, see detail::make_limb_literal.
+             */
+            template <std::size_t N>
+            explicit real(const detail::limb_literal<T, N>& literal) {
+                if (literal.is_integral()) {
+                    this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(literal.numerator()));
+                } else {
+                    std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(literal.numerator()));
+                    std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(literal.denominator()));
+
+                    this->_real_p = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+                }
+            }
+
             /**
              * @brief Initializer list constructor
              *
@@ -233,12 +502,12 @@ namespace boost {
              * integer part and the lambda function digits is used to know the number digits,
              * this function returns the n-th number digit.
              *
-             * @param get_nth_digit - a function pointer or lambda function that given an unsigned
-             * int "n" as parameter, it returns the number n-th digit.
+             * @param get_nth_digit - a function pointer, lambda function or function object that
+             * given an unsigned int "n" as parameter, it returns the number n-th digit.
              * @param exponent - an integer representing the number exponent.
              */
-            real(T (*get_nth_digit)(unsigned int), int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent)))
+            real(typename real_algorithm<T>::nth_digit_function get_nth_digit, int exponent)
+                    : _real_p(std::make_shared<real_data<T>>(real_algorithm<T>(std::move(get_nth_digit), exponent)))
                     {};
 
             /**
@@ -248,19 +517,33 @@ namespace boost {
              * the n-th number digit. This constructor uses the sign to determine if the number
              * is positive or negative.
              *
-             * @param get_nth_digit - a function pointer or lambda function that given an unsigned
-             * int "n" as parameter, it returns the number n-th digit.
+             * @param get_nth_digit - a function pointer, lambda function or function object that
+             * given an unsigned int "n" as parameter, it returns the number n-th digit.
              * @param exponent - an integer representing the number exponent.
              * @param positive - a bool that represent the number sign. If positive is set to true,
              * the number is positive, otherwise is negative.
              */
-            real(T (*get_nth_digit)(unsigned int), int exponent, bool positive) 
-                 : _real_p(::std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
+            real(typename real_algorithm<T>::nth_digit_function get_nth_digit, int exponent, bool positive) 
+                 : _real_p(::std::make_shared<real_data<T>>(real_algorithm<T>(std::move(get_nth_digit), exponent, positive))) {};
+
+            /**
+             * @brief *Block function constructor:* Creates a boost::real::real instance whose digits
+             * are produced in blocks by get_digits (see boost::real::real_algorithm).
+             *
+             * @param get_digits - a function pointer, lambda function or function object that given
+             * an unsigned int "start", an unsigned int "count" and a pointer "out", writes the
+             * number digits start to start + count - 1 to out.
+             * @param exponent - an integer representing the number exponent.
+             * @param positive - a bool that represent the number sign. If positive is set to true,
+             * the number is positive, otherwise is negative.
+             */
+            real(typename real_algorithm<T>::digits_function get_digits, int exponent, bool positive = true)
+                 : _real_p(std::make_shared<real_data<T>>(real_algorithm<T>(std::move(get_digits), exponent, positive))) {};
 
             // ctors from the 3 underlying types
-            real(real_explicit<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_algorithm<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_operation<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
+            real(real_explicit<T> x) : _real_p(std::make_shared<real_data<T>>(std::move(x))) {};
+            real(real_algorithm<T> x) : _real_p(std::make_shared<real_data<T>>(std::move(x))) {};
+            real(real_operation<T> x) : _real_p(std::make_shared<real_data<T>>(std::move(x))) {};
 
             /**
              * @brief Default destructor
@@ -272,6 +555,8 @@ namespace boost {
             }
 
             const_precision_iterator<T> get_real_itr() const {
+                // the iterator may be refined meanwhile as the operand of a number evaluated on another thread
+                std::lock_guard<std::recursive_mutex> lock(_real_p->get_precision_itr().mutex());
                 return _real_p->get_precision_itr();
             }
 
@@ -282,11 +567,13 @@ namespace boost {
              * @return and integer with the maximum allowed precision.
              */
             unsigned int maximum_precision() const {
-                return get_real_itr().maximum_precision();
+                std::lock_guard<std::recursive_mutex> lock(_real_p->get_precision_itr().mutex());
+                return _real_p->get_precision_itr().maximum_precision();
             }
 
             /// set max precision for the underlying iterator
             void set_maximum_precision(unsigned int maximum_precision) {
+                std::lock_guard<std::recursive_mutex> lock(_real_p->get_precision_itr().mutex());
                 this->_real_p->get_precision_itr().set_maximum_precision(maximum_precision);
             }
 
@@ -340,8 +627,21 @@ namespace boost {
                         std::cout << "alg\n";
                     },
                     [&space] (const real_operation<T>& real) {
-                        ((boost::real::real<T>) real.rhs()).print_tree(space + PRINT_SPACE);
-                        std::cout << '\n';
+                        if (is_n_ary(real.get_operation())) {
+                            for (auto operand = real.operands().rbegin(); operand != real.operands().rend(); ++operand) {
+                                ((boost::real::real<T>) *operand).print_tree(space + PRINT_SPACE);
+                                std::cout << '\n';
+                            }
+                            for (int i = PRINT_SPACE; i < space; i++)
+                                std::cout << ' ';
+                            std::cout << ((real.get_operation() == OPERATION::SUM) ? "sum" : "product") << '\n';
+                            return;
+                        }
+
+                        if (real.rhs() != nullptr) {
+                            ((boost::real::real<T>) real.rhs()).print_tree(space + PRINT_SPACE);
+                            std::cout << '\n';
+                        }
 
                         for (int i = PRINT_SPACE; i < space; i++)
                             std::cout << ' ';
@@ -617,8 +917,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real exp(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::EXPONENT));
+                return real(real_operation<T>(real_num._real_p, OPERATION::EXPONENT));
             }
 
             /**
@@ -629,8 +928,38 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real log(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
+                return real(real_operation<T>(real_num._real_p, OPERATION::LOGARITHM));
+            }
+
+            /**
+             *      EVALUATE METHOD
+             * @brief: Approximates real_num by an interval at most target_error wide. Instead of
+             * iterating the whole operation tree with the same precision, every operand is refined
+             * only as much as its contribution to the error of the result requires.
+             * @params: real_num: boost::real number to evaluate.
+             * @params: target_error: maximum width of the resulting interval, must be positive.
+             * @return: returns an interval containing real_num that is at most target_error wide.
+             * @throws: boost::real::precision_exception if the maximum precision is not enough.
+             * @throws: boost::real::non_positive_target_error_exception if target_error is not positive.
+             **/
+            static interval<T> evaluate(const real<T>& real_num, const exact_number<T>& target_error) {
+                if (!(target_error > literals::zero_exact<T>)) {
+                    throw non_positive_target_error_exception();
+                }
+
+                const_precision_iterator<T>& itr = real_num._real_p->get_precision_itr();
+
+                // base^(exponent - 1) <= target_error, one more digit is asked each round the estimate falls short
+                int error_exponent = target_error.exponent - 1;
+                for (unsigned int round = 0; round <= itr.maximum_precision(); ++round) {
+                    itr.refine_to_error(error_exponent - (int) round);
+
+                    interval<T> approximation = itr.interval_snapshot();
+                    if (approximation.upper_bound - approximation.lower_bound <= target_error) {
+                        return approximation;
+                    }
+                }
+                throw precision_exception();
             }
 
             /*      POWER METHOD
@@ -643,7 +972,6 @@ namespace boost {
 
             static real power(real<T> real_num, real<T> power){
                 // checking whether the number is integer or not
-                static real<T> zero("0");
                 static real<T> one("1");
                 real<T> result;
 
@@ -668,9 +996,9 @@ namespace boost {
                     /**
                      * Now, if number is negative, then logarithm function will check out and throw error
                      **/
-                    result = real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
+                    result = real(real_operation<T>(real_num._real_p, OPERATION::LOGARITHM));
                     result = real(real_operation<T>(result._real_p, power._real_p, OPERATION::MULTIPLICATION));
-                    result = real(real_operation<T>(result._real_p, zero._real_p, OPERATION::EXPONENT));
+                    result = real(real_operation<T>(result._real_p, OPERATION::EXPONENT));
                     }
                     catch(const logarithm_not_defined_for_non_positive_number& e3){
                         throw non_integral_power_of_negative_number();
@@ -689,12 +1017,11 @@ namespace boost {
 
             static real sqrt(real<T> real_num){
                 real<T> power("1/2", TYPE::RATIONAL);
-                real<T> zero("0");
                 real<T> result;
                 try{
-                    result = real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
+                    result = real(real_operation<T>(real_num._real_p, OPERATION::LOGARITHM));
                     result = real(real_operation<T>(result._real_p, power._real_p, OPERATION::MULTIPLICATION));
-                    result = real(real_operation<T>(result._real_p, zero._real_p, OPERATION::EXPONENT));
+                    result = real(real_operation<T>(result._real_p, OPERATION::EXPONENT));
                 }
                 catch(const logarithm_not_defined_for_non_positive_number& e){
                     throw sqrt_not_defined_for_negative_number();
@@ -711,8 +1038,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real sin(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SIN));
+                return real(real_operation<T>(real_num._real_p, OPERATION::SIN));
             }
 
             /**
@@ -723,8 +1049,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cos(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COS));
+                return real(real_operation<T>(real_num._real_p, OPERATION::COS));
             }
 
 
@@ -736,8 +1061,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real tan(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::TAN));
+                return real(real_operation<T>(real_num._real_p, OPERATION::TAN));
             }
 
             /**
@@ -748,8 +1072,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cot(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COT));
+                return real(real_operation<T>(real_num._real_p, OPERATION::COT));
             }
 
             /**
@@ -760,8 +1083,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real sec(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SEC));
+                return real(real_operation<T>(real_num._real_p, OPERATION::SEC));
             }
 
             /**
@@ -772,8 +1094,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cosec(real<T> real_num){
-                static real<T> zero("0");
-                return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COSEC));
+                return real(real_operation<T>(real_num._real_p, OPERATION::COSEC));
             }
 
 
@@ -787,6 +1108,14 @@ namespace boost {
              */
 
             void operator += (real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::ADDITION)) {
+                    _real_p = folded->_real_p;
+                    return;
+                }
+                if (extend(other, OPERATION::SUM)) {
+                    return;
+                }
+
                 std::visit( overloaded{ 
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
@@ -868,6 +1197,10 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator + (real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::ADDITION)) {
+                    return *folded;
+                }
+
                 real<T> result;
                 std::visit( overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
@@ -951,6 +1284,11 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator -= (real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::SUBTRACTION)) {
+                    _real_p = folded->_real_p;
+                    return;
+                }
+
                 std::visit(overloaded{
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
@@ -1033,6 +1371,10 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator - (real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::SUBTRACTION)) {
+                    return *folded;
+                }
+
                 real<T> result;
                 std::visit( overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
@@ -1115,6 +1457,14 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator*=(real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::MULTIPLICATION)) {
+                    _real_p = folded->_real_p;
+                    return;
+                }
+                if (extend(other, OPERATION::PRODUCT)) {
+                    return;
+                }
+
                 std::visit(overloaded{
                     [this] (real_rational<T> a, real_rational<T> b){
                         this->_real_p = 
@@ -1189,6 +1539,10 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator * (real<T> other) {
+                if (std::optional<real<T>> folded = fold(other, OPERATION::MULTIPLICATION)) {
+                    return *folded;
+                }
+
                 real<T> result;
                 std::visit(overloaded{
                     [&result] (real_rational<T> a, real_rational<T> b){
@@ -1433,129 +1787,10 @@ namespace boost {
                         ret = (a<b);
                     },
 
-                    [this, &other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this;
-                        if(rat_num.b == literals::one_integer<T>)
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-
-                        // now comparing numbers
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-
-                        // now comparing numbers
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if(this_it == other_it)
-                        {
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p){
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision){
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
                     [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
+                        // continue from the precision the previous comparisons of both numbers reached
+                        auto& this_it = this->_real_p->get_comparison_itr();
+                        auto& other_it = other._real_p->get_comparison_itr();
 
                         if (this_it == other_it)
                         {
@@ -1563,35 +1798,7 @@ namespace boost {
                             return;
                         }
 
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() < other_it.get_interval();
-                                break;
-                            }
-
-                            if (this_it.get_interval()< other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-
-                            if (other_it.get_interval()< this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
+                        ret = compare(this_it, other_it, std::max(this->maximum_precision(), other.maximum_precision()), less_than);
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
                 return ret;
@@ -1616,149 +1823,18 @@ namespace boost {
                         ret = (a>b);
                     },
 
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b == literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        if (this_it == other_it){
-                            ret = false;
-                            return;
-                        }
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-                    },
-
                     [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
+                        // continue from the precision the previous comparisons of both numbers reached
+                        auto& this_it = this->_real_p->get_comparison_itr();
+                        auto& other_it = other._real_p->get_comparison_itr();
 
-                        if (this_it == other_it){
+                        if (this_it == other_it)
+                        {
                             ret = false;
                             return;
                         }
 
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p=0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval() > other_it.get_interval();
-                                break;
-                            }
-                            if (this_it.get_interval()> other_it.get_interval()) {
-                                ret = true;
-                                break;
-                            }
-                            if (other_it.get_interval()> this_it.get_interval()) {
-                                ret = false;
-                                break;
-                            }
-                        }
-                        // If the precision is reached and the number ranges still overlap, then we cannot
-                        // know if they are equals or other is less than this and we throw an error.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
+                        ret = compare(this_it, other_it, std::max(this->maximum_precision(), other.maximum_precision()), greater_than);
                     }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
                 return ret;
@@ -1782,139 +1858,13 @@ namespace boost {
                         ret = (a==b);
                     },
 
-                    [&other, &ret] (real_rational<T> rat_num, auto tmp){
-                        real<T> _this; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            _this._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = _this._real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(_this.maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p==current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
-                    [this, &ret] (auto tmp, real_rational<T> rat_num){
-                        real<T> other; // representing "other" number, which is a rational number
-                        if(rat_num.b==literals::one_integer<T>)   
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-                        else {
-                            real _a, _b; // to represent "a" and "b" in rational number a/b
-                            _a._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.a));
-
-                            _b._real_p = 
-                                std::make_shared<real_data<T>>(real_explicit<T>(rat_num.b));
-
-                            other._real_p = 
-                                std::make_shared<real_data<T>>(real_operation<T>(_a._real_p, _b._real_p, OPERATION::DIVISION));
-
-                        }
-
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-                    },
-
                     [this, &other, &ret] (auto a, auto b){
-                        auto this_it = this->_real_p->get_precision_itr().cbegin();
-                        auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                        unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                        unsigned int p;
-                        for (p = 0; p < current_precision; ++p) {
-                            // Get more precision
-                            ++this_it;
-                            ++other_it;
-
-                            bool this_full_precision = this_it.get_interval().is_a_number();
-                            bool other_full_precision = other_it.get_interval().is_a_number();
-                            if (this_full_precision && other_full_precision) {
-                                ret = this_it.get_interval()== other_it.get_interval();
-                                break;
-                            }
-
-                            bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                            bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                            if (this_is_lower || other_is_lower) {
-                                ret = false;
-                                break;
-                            }
-                        }
-
-                        // If the precision is reached and the numbers full precision is not reached, then
-                        // we cannot know if they are equals or not.
-                        if(p == current_precision)
-                            throw boost::real::precision_exception();
-
-                    } 
+                        // continue from the precision the previous comparisons of both numbers reached
+                        auto& this_it = this->_real_p->get_comparison_itr();
+                        auto& other_it = other._real_p->get_comparison_itr();
 
+                        ret = compare(this_it, other_it, std::max(this->maximum_precision(), other.maximum_precision()), equal);
+                    }
                 }, _real_p->get_real_number(), other._real_p->get_real_number());
 
                 return ret;
@@ -2006,12 +1956,24 @@ namespace boost {
 
 //User Defined Literals for Explicit Number
 
-inline auto operator "" _r(long double x) {
-    return boost::real::real<int>(std::to_string(x));
-}
-
-inline auto operator "" _r(unsigned long long x) {
-    return boost::real::real<int>(std::to_string(x));
+// Numeric literals are converted to limbs at compile time, and keep all their digits. Integers
+// may be written in hexadecimal (0x), octal (0) or binary (0b), as for the built-in types.
+template <char... Chars>
+inline auto operator "" _r() {
+    static constexpr char number[] = {Chars..., '\0'};
+    constexpr std::size_t length = sizeof...(Chars);
+    constexpr unsigned radix = boost::real::detail::literal_radix(number, length);
+    if constexpr (radix == 10) {
+        constexpr std::size_t capacity = boost::real::detail::limb_literal_capacity<int>(number, length);
+        constexpr auto literal = boost::real::detail::parse_limb_literal<int, capacity>(number, length);
+        return boost::real::real<int>(literal);
+    } else {
+        static_assert(radix != 16 || !boost::real::detail::is_hexadecimal_floating_literal(number, length),
+                      "_r does not support hexadecimal floating literals, write the number in decimal");
+        constexpr std::size_t capacity = boost::real::detail::integer_literal_capacity<int>(length, radix);
+        constexpr auto literal = boost::real::detail::parse_integer_limb_literal<int, capacity>(number, length, radix);
+        return boost::real::real<int>(literal);
+    }
 }
 
 inline auto operator "" _r(const char* x, size_t len) {
@@ -2,6 +2,11 @@
 #define BOOST_REAL_REAL_ALGORITHM_HPP
 
 #include <real/real_exception.hpp>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace boost { 
     namespace real {
@@ -11,20 +16,66 @@ namespace boost {
          * @brief boost::real::real_algorithm is a C++ class that represents real numbers as a
          * a function that calculates the n-th digit o the number, a sign and an exponent.
          *
-         * @details Because a function pointer of lambda function is used to obtain the number
-         * digits on demand, numbers with infinite representations as the irrational numbers can be
-         * represented using this class.
+         * @details Because a function pointer, lambda function or function object is used to
+         * obtain the number digits on demand, numbers with infinite representations as the
+         * irrational numbers can be represented using this class. Every digit is produced once:
+         * the digits are kept in a cache shared by all the copies of the number, and so by all
+         * its iterators.
+         *
+         * The digit functions are shared along with the cache, and they are always asked for the
+         * digits in increasing order, each one once, one call at a time. So a function object
+         * may keep the state of a spigot or a series from a call to the next and stream the
+         * digits, instead of computing every digit from scratch.
          */
         
         template <typename T = int>
         class real_algorithm {
+            public:
+            /// a function that returns the n-th digit of the number
+            using nth_digit_function = std::function<T(unsigned int)>;
+
+            /// a function that writes the digits start, ..., start + count - 1 of the number to out
+            using digits_function = std::function<void(unsigned int start, unsigned int count, T *out)>;
+
+            private:
+            /// the function computing the digits and the digits produced so far, which only grows
+            struct digit_source {
+                nth_digit_function get_nth_digit;
+                digits_function get_digits;
+                std::vector<T> digits;
+                std::mutex mutex;
+            };
 
-            // Number representation as a function that returns the number digits
-            // an integer part and a sign (+/-)
-            T (*_get_nth_digit)(unsigned int);
+            // Number representation as a function that returns the number digits, or a function
+            // that writes a block of them, an integer part and a sign (+/-)
+            std::shared_ptr<digit_source> _source = std::make_shared<digit_source>();
             int _exponent;
             bool _positive;
 
+            /**
+             * @brief Produces the digits up to index end, excluded, that are not cached yet. Block
+             * producers are asked for at least as many digits as already cached, so that digits
+             * requested one by one cost a logarithmic number of calls. _source->mutex must be held.
+             */
+            void fill(size_t end) const {
+                std::vector<T> &digits = _source->digits;
+                const size_t start = digits.size();
+                if (end <= start) {
+                    return;
+                }
+
+                if (_source->get_digits) {
+                    std::vector<T> block(std::max(end, 2 * start) - start);
+                    _source->get_digits(start, block.size(), block.data());
+                    digits.insert(digits.end(), block.cbegin(), block.cend());
+                } else {
+                    digits.reserve(end);
+                    for (size_t i = start; i < end; ++i) {
+                        digits.push_back(_source->get_nth_digit(i));
+                    }
+                }
+            }
+
             public:
             /**
              * @brief *Default constructor:* Construct an empty boost::real::real_algorithm with
@@ -45,12 +96,12 @@ namespace boost {
              * integer part and the lambda function digits is used to know the number digits,
              * this function returns the n-th number digit. The number is positive.
              *
-             * @param get_nth_digit - a function pointer or lambda function that given an unsigned
-             * int "n" as parameter, returns the number n-th digit.
+             * @param get_nth_digit - a function pointer, lambda function or function object that
+             * given an unsigned int "n" as parameter, returns the number n-th digit.
              * @param exponent - an integer representing the number exponent.
              */
-            explicit real_algorithm(T (*get_nth_digit)(unsigned int), int exponent)
-                    : _get_nth_digit(get_nth_digit), _exponent(exponent), _positive(true) {}
+            explicit real_algorithm(nth_digit_function get_nth_digit, int exponent)
+                    : real_algorithm(std::move(get_nth_digit), exponent, true) {}
 
             /**
              * @brief *Lambda function constructor with exponent and sign:* Creates a boost::real::real_algorithm instance
@@ -59,19 +110,40 @@ namespace boost {
              * the n-th number digit. This constructor uses the sign to determine if the number
              * is positive or negative.
              *
-             * @param get_nth_digit - a function pointer or lambda function that given an unsigned
-             * int "n" as parameter, returns the number n-th digit.
+             * @param get_nth_digit - a function pointer, lambda function or function object that
+             * given an unsigned int "n" as parameter, returns the number n-th digit.
              * @param exponent - an integer representing the number exponent.
              * @param positive - a bool that represent the number sign. If positive is set to true,
              * the number is positive, otherwise is negative.
              */
-            explicit real_algorithm(T (*get_nth_digit)(unsigned int),
+            explicit real_algorithm(nth_digit_function get_nth_digit,
                                     int exponent,
                                     bool positive)
-                    : _get_nth_digit(get_nth_digit),
-                      _exponent(exponent),
-                      _positive(positive)
-                     {};
+                    : _exponent(exponent),
+                      _positive(positive) {
+                _source->get_nth_digit = std::move(get_nth_digit);
+            }
+
+            /**
+             * @brief *Block function constructor:* Creates a boost::real::real_algorithm instance
+             * whose digits are produced in blocks, for numbers whose digits are naturally computed
+             * many at a time.
+             *
+             * @param get_digits - a function pointer, lambda function or function object that
+             * given an unsigned int "start", an unsigned int "count" and a pointer "out", writes
+             * the digits start, start + 1, ..., start + count - 1 of the number to out[0], ...,
+             * out[count - 1].
+             * @param exponent - an integer representing the number exponent.
+             * @param positive - a bool that represent the number sign. If positive is set to true,
+             * the number is positive, otherwise is negative.
+             */
+            explicit real_algorithm(digits_function get_digits,
+                                    int exponent,
+                                    bool positive = true)
+                    : _exponent(exponent),
+                      _positive(positive) {
+                _source->get_digits = std::move(get_digits);
+            }
 
             /**
              * @return An integer with the number exponent
@@ -93,7 +165,33 @@ namespace boost {
              * @param n - an unsigned int number indicating the index of the requested digit.
              * @return an integer with the value of the number n-th digit.
              */
-            T operator[](unsigned int n) const { return this->_get_nth_digit(n); }
+            T operator[](unsigned int n) const {
+                std::lock_guard<std::mutex> lock(_source->mutex);
+                fill((size_t) n + 1);
+                return _source->digits[n];
+            }
+
+            /**
+             * @brief Writes the digits start, start + 1, ..., start + count - 1 of the number to out,
+             * producing only those that are not cached yet.
+             *
+             * @param out - an output iterator the digits are written to.
+             * @return the output iterator past the last written digit.
+             */
+            template <typename OutputIt>
+            OutputIt get_digits(unsigned int start, unsigned int count, OutputIt out) const {
+                std::lock_guard<std::mutex> lock(_source->mutex);
+                fill((size_t) start + count);
+                return std::copy_n(_source->digits.cbegin() + start, count, out);
+            }
+
+            /**
+             * @return The number of digits already produced, that is shared by the copies of the number.
+             */
+            size_t cached_digits() const {
+                std::lock_guard<std::mutex> lock(_source->mutex);
+                return _source->digits.size();
+            }
 
             /**
              * @brief It assign a new copy of the other boost::real::real_algorithm number in the *this boost::real::real_algorithm number.
@@ -5,6 +5,11 @@
 #include <assert.h>
 #include <iostream>
 #include <limits>
+#include <algorithm>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <optional>
 
 #include <real/const_precision_iterator.hpp>
 #include <real/interval.hpp>
@@ -21,62 +26,513 @@ namespace boost {
 
         template <typename T = int>
         class real_data {
-            real_number<T> _real;
+            // shared with the iterators of the number, which therefore never copy it
+            std::shared_ptr<real_number<T>> _real;
             const_precision_iterator<T> _precision_itr;
 
+            // refined by the comparisons only, see get_comparison_itr
+            std::optional<const_precision_iterator<T>> _comparison_itr;
+
             public:
             /// @TODO: use move constructors, if possible
             
-            real_data() = default;
+            real_data() : _real(std::make_shared<real_number<T>>()) {};
             
-            /// copy ctor - constructs real_data from other real_data
-            real_data(const real_data<T> &other) : _real(other._real), _precision_itr(other._precision_itr) {};
+            /// copy ctor - constructs real_data from other real_data, whose comparisons the copy starts over
+            real_data(const real_data<T> &other) : _real(other._real) {
+                std::lock_guard<std::recursive_mutex> lock(other._precision_itr.mutex());
+                _precision_itr = other._precision_itr;
+            };
 
             // construct from the three different reals 
-            real_data(real_explicit<T> x) :_real(x), _precision_itr(&_real) {};
-            real_data(real_algorithm<T> x) : _real(x), _precision_itr(&_real) {};
-            real_data(real_operation<T> x) : _real(x), _precision_itr(&_real) {};
-            real_data(real_rational<T> x) : _real(x), _precision_itr(&_real) {};
+            real_data(real_explicit<T> x) : _real(std::make_shared<real_number<T>>(std::move(x))), _precision_itr(_real) {};
+            real_data(real_algorithm<T> x) : _real(std::make_shared<real_number<T>>(std::move(x))), _precision_itr(_real) {};
+            real_data(real_operation<T> x) : _real(std::make_shared<real_number<T>>(std::move(x))), _precision_itr(_real) {};
+            real_data(real_rational<T> x) : _real(std::make_shared<real_number<T>>(std::move(x))), _precision_itr(_real) {};
             const real_number<T>& get_real_number() const {
-                return _real;
+                return *_real;
             }
 
             real_number<T> const * get_real_ptr() const {
-                return &_real;
+                return _real.get();
+            }
+
+            /**
+             * @brief Adds operand to this node if it is an op (a SUM or a PRODUCT) and nothing but
+             * this real_data and its own iterators refer to its number, which can then change
+             * unnoticed. The caller must be the only owner of this real_data.
+             *
+             * @return false, leaving the node unchanged, otherwise.
+             */
+            bool push_operand(std::shared_ptr<real_data<T>> operand, OPERATION op) {
+                auto operation = std::get_if<real_operation<T>>(_real.get());
+                if (operation == nullptr || operation->get_operation() != op || _real.use_count() != (_comparison_itr ? 3 : 2)) {
+                    return false;
+                }
+
+                _comparison_itr.reset();
+                operation->push_operand(std::move(operand));
+                _precision_itr.add_last_operand(*operation);
+                return true;
             }
 
             const_precision_iterator<T>& get_precision_itr() {
                 return _precision_itr;
             }
+
+            /**
+             * @brief The iterator the comparisons of this number refine. It is kept between
+             * comparisons, so comparing the same number many times, as a sort does, continues from
+             * the highest precision any previous comparison reached instead of starting over.
+             * It is separate from get_precision_itr so that comparing a number never changes the
+             * intervals it shows as an operand or through real::get_real_itr.
+             */
+            const_precision_iterator<T>& get_comparison_itr() {
+                std::lock_guard<std::recursive_mutex> lock(_precision_itr.mutex());
+                if (!_comparison_itr) {
+                    _comparison_itr = _precision_itr;
+                }
+                return *_comparison_itr;
+            }
+
+            /**
+             * @brief Destroys the operation tree below this node without recursion. Letting the
+             * shared pointers cascade would use one stack frame chain per level of the tree, so the
+             * operands only owned by this tree are unlinked from their own operands before they
+             * are released.
+             */
+            ~real_data() {
+                std::vector<std::shared_ptr<real_data<T>>> operands;
+                release_operands(operands);
+
+                while (!operands.empty()) {
+                    std::shared_ptr<real_data<T>> operand = std::move(operands.back());
+                    operands.pop_back();
+
+                    // shared operands are kept alive by their other owners and are not unlinked
+                    if (operand.use_count() == 1) {
+                        operand->release_operands(operands);
+                    }
+                }
+            }
+
+            private:
+            /// moves the operands of this node, if it is an operation, into operands
+            void release_operands(std::vector<std::shared_ptr<real_data<T>>> &operands) {
+                // the number is shared with the iterators, the last of them releases its operands
+                _comparison_itr.reset();
+                _real.reset();
+                _precision_itr.release_operands(operands);
+            }
         };
 
         // Now that real_data and const_precision_iterator have been defined, we may now define the following.
         // Note these are all inline to avoid linker issues.
 
         /* const_precision_iterator member functions */
+        namespace detail {
+            /**
+             * @brief Sets delta = current - previous when the two truncated bounds only differ in
+             * their lower digits, which is the usual case between two consecutive iterations.
+             *
+             * @return false if the numbers differ in their sign, exponent or most of their digits,
+             * in which case a full computation is as cheap as refining.
+             */
+            template <typename T>
+            bool truncation_delta(const exact_number<T> &current, const exact_number<T> &previous, exact_number<T> &delta) {
+                if (previous.digits.empty() || current.positive != previous.positive || current.exponent != previous.exponent) {
+                    return false;
+                }
+
+                auto [current_it, previous_it] = std::mismatch(current.digits.cbegin(), current.digits.cend(),
+                                                               previous.digits.cbegin(), previous.digits.cend());
+                size_t common = current_it - current.digits.cbegin();
+
+                if (current_it == current.digits.cend() && previous_it == previous.digits.cend()) {
+                    delta = exact_number<T>();
+                    return true;
+                }
+
+                if (2 * common < current.digits.size()) {
+                    return false;
+                }
+
+                auto tail = [common](const exact_number<T> &number, auto first) {
+                    exact_number<T> result(std::vector<T>(first, number.digits.cend()), number.exponent - (int) common, number.positive);
+                    if (result.digits.empty()) {
+                        result.digits.push_back(0);
+                    }
+                    result.normalize();
+                    return result;
+                };
+
+                delta = tail(current, current_it) - tail(previous, previous_it);
+                return true;
+            }
+        }
+
+        /**
+         * @brief Computes one bound of an addition, subtraction or multiplication interval from the
+         * operand bounds truncated to the current precision.
+         *
+         * If incremental is set, the bound and stored still hold the previous bound and the operands
+         * it was computed from, and the bound is corrected with the operand differences only:
+         *     a' + b' = (a + b) + (a' - a) + (b' - b)
+         *     a' * b' = a * b + a * (b' - b) + (a' - a) * b'
+         * The differences are as long as the digits that changed since the last iteration, so
+         * the additions are in place and the multiplications are O(n * changed digits).
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_operation_bound(exact_number<T> &bound, refinement_operands &stored, OPERATION op,
+                                                                        const exact_number<T> &lhs, bool lhs_upper,
+                                                                        const exact_number<T> &rhs, bool rhs_upper, bool incremental) {
+            exact_number<T> lhs_truncated = lhs.up_to(_precision, lhs_upper);
+            exact_number<T> rhs_truncated = rhs.up_to(_precision, rhs_upper);
+            exact_number<T> lhs_delta;
+            exact_number<T> rhs_delta;
+
+            if (incremental && detail::truncation_delta(lhs_truncated, stored.lhs, lhs_delta)
+                            && detail::truncation_delta(rhs_truncated, stored.rhs, rhs_delta)) {
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        bound.accumulate(lhs_delta);
+                        bound.accumulate(rhs_delta);
+                        break;
+
+                    case OPERATION::SUBTRACTION:
+                        bound.accumulate(lhs_delta);
+                        rhs_delta.positive = !rhs_delta.positive;
+                        bound.accumulate(rhs_delta);
+                        break;
+
+                    default:
+                        if (!rhs_delta.digits.empty()) {
+                            bound.accumulate(stored.lhs * rhs_delta);
+                        }
+                        if (!lhs_delta.digits.empty()) {
+                            bound.accumulate(lhs_delta * rhs_truncated);
+                        }
+                }
+            } else {
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        bound = lhs_truncated + rhs_truncated;
+                        break;
+
+                    case OPERATION::SUBTRACTION:
+                        bound = lhs_truncated - rhs_truncated;
+                        break;
+
+                    default:
+                        bound = lhs_truncated * rhs_truncated;
+                }
+            }
+
+            stored.lhs = std::move(lhs_truncated);
+            stored.rhs = std::move(rhs_truncated);
+        }
+
+        /**
+         * @brief Computes the interval of an addition, subtraction or multiplication whose bounds
+         * only depend on one operand bound each. operands_case tells which ones:
+         *
+         *  case | operation                     | lower bound          | upper bound
+         *  0    | addition                      | lhs.lower, rhs.lower | lhs.upper, rhs.upper
+         *  1    | subtraction                   | lhs.lower, rhs.upper | lhs.upper, rhs.lower
+         *  2    | multiplication, (+) * (+)     | lhs.lower, rhs.lower | lhs.upper, rhs.upper
+         *  3    | multiplication, (-) * (-)     | lhs.upper, rhs.upper | lhs.lower, rhs.lower
+         *  4    | multiplication, (-) * (+)     | lhs.lower, rhs.upper | lhs.upper, rhs.lower
+         *  5    | multiplication, (+) * (-)     | lhs.upper, rhs.lower | lhs.lower, rhs.upper
+         *
+         * The previous interval is refined if it was computed for the same case.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_operation_interval(real_operation<T> &ro, int operands_case) {
+            static constexpr bool lower_uses_upper[6][2] = {{false, false}, {false, true}, {false, false},
+                                                            {true, true}, {false, true}, {true, false}};
+
+            const interval<T> &lhs = ro.get_lhs_itr().get_interval();
+            const interval<T> &rhs = ro.get_rhs_itr().get_interval();
+            bool incremental = incremental_refinement && this->_refinement.operands_case == operands_case;
+
+            bool lhs_upper = lower_uses_upper[operands_case][0];
+            bool rhs_upper = lower_uses_upper[operands_case][1];
+            update_operation_bound(this->_approximation_interval.lower_bound, this->_refinement.lower, ro.get_operation(),
+                                   lhs_upper ? lhs.upper_bound : lhs.lower_bound, lhs_upper,
+                                   rhs_upper ? rhs.upper_bound : rhs.lower_bound, rhs_upper, incremental);
+
+            // the upper bound always uses the opposite operand bounds
+            update_operation_bound(this->_approximation_interval.upper_bound, this->_refinement.upper, ro.get_operation(),
+                                   lhs_upper ? lhs.lower_bound : lhs.upper_bound, !lhs_upper,
+                                   rhs_upper ? rhs.lower_bound : rhs.upper_bound, !rhs_upper, incremental);
+
+            this->_refinement.operands_case = operands_case;
+        }
+
+        namespace detail {
+            /// the sum of terms, added in pairs so that the partial sums stay about as long as the terms
+            template <typename T>
+            exact_number<T> pairwise_sum(std::vector<exact_number<T>> terms) {
+                for (size_t width = 1; width < terms.size(); width *= 2) {
+                    for (size_t i = 0; i + width < terms.size(); i += 2 * width) {
+                        terms[i] = terms[i] + terms[i + width];
+                    }
+                }
+                return terms.empty() ? exact_number<T>() : std::move(terms.front());
+            }
+
+            /// an interval containing x * y, with bounds rounded outwards to precision digits
+            template <typename T>
+            interval<T> multiply_intervals(const interval<T> &x, const interval<T> &y, size_t precision) {
+                interval<T> product;
+                if (x.positive() && y.positive()) {
+                    product.lower_bound = x.lower_bound * y.lower_bound;
+                    product.upper_bound = x.upper_bound * y.upper_bound;
+                } else {
+                    exact_number<T> products[4] = {x.lower_bound * y.lower_bound, x.lower_bound * y.upper_bound,
+                                                   x.upper_bound * y.lower_bound, x.upper_bound * y.upper_bound};
+                    product.lower_bound = *std::min_element(std::begin(products), std::end(products));
+                    product.upper_bound = *std::max_element(std::begin(products), std::end(products));
+                }
+                product.lower_bound = product.lower_bound.up_to(precision, false);
+                product.upper_bound = product.upper_bound.up_to(precision, true);
+                return product;
+            }
+
+            /// the interval of an operand truncated outwards to precision digits
+            template <typename T>
+            interval<T> truncated_interval(const interval<T> &x, size_t precision) {
+                interval<T> truncated;
+                truncated.lower_bound = x.lower_bound.up_to(precision, false);
+                truncated.upper_bound = x.upper_bound.up_to(precision, true);
+                return truncated;
+            }
+
+            /**
+             * @brief |number|^n with every intermediate square and product rounded to precision
+             * digits, upwards when upper is set and downwards otherwise. All the intermediate
+             * values are non negative, so the result is an upper (lower) bound of the exact power
+             * whose length does not grow with n (see exact_number::sliding_window_power).
+             */
+            template <typename T>
+            exact_number<T> rounded_power(exact_number<T> number, unsigned long long n, size_t precision, bool upper) {
+                number.positive = true;
+                number = number.up_to(precision, upper);
+                return exact_number<T>::sliding_window_power(number, n, [precision, upper](exact_number<T> &&power) {
+                    return power.up_to(precision, upper);
+                });
+            }
+        }
+
+        /**
+         * @brief Computes the interval of a SUM from its operand bounds truncated to the current
+         * precision. The bounds are added pairwise, and as every operand is truncated once the
+         * width of the sum is at most the sum of the operand widths plus one unit per operand.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_sum_interval(real_operation<T> &ro) {
+            std::vector<exact_number<T>> lower_bounds;
+            std::vector<exact_number<T>> upper_bounds;
+            lower_bounds.reserve(ro.operand_count());
+            upper_bounds.reserve(ro.operand_count());
+
+            for (size_t i = 0; i < ro.operand_count(); ++i) {
+                const interval<T> &operand = ro.get_operand_itr(i).get_interval();
+                lower_bounds.push_back(operand.lower_bound.up_to(_precision, false));
+                upper_bounds.push_back(operand.upper_bound.up_to(_precision, true));
+            }
+
+            this->_approximation_interval.lower_bound = detail::pairwise_sum(std::move(lower_bounds));
+            this->_approximation_interval.upper_bound = detail::pairwise_sum(std::move(upper_bounds));
+            this->_refinement.operands_case = -1;
+        }
+
+        /**
+         * @brief Computes the interval of a PRODUCT from its operand intervals truncated to the
+         * current precision. The intervals are multiplied pairwise, as a balanced tree, and every
+         * partial product is rounded outwards to the current precision, so neither the length of
+         * the bounds nor the rounding error grows with the number of operands.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_product_interval(real_operation<T> &ro) {
+            std::vector<interval<T>> factors;
+            factors.reserve(ro.operand_count());
+            for (size_t i = 0; i < ro.operand_count(); ++i) {
+                factors.push_back(detail::truncated_interval(ro.get_operand_itr(i).get_interval(), _precision));
+            }
+
+            for (size_t width = 1; width < factors.size(); width *= 2) {
+                for (size_t i = 0; i + width < factors.size(); i += 2 * width) {
+                    factors[i] = detail::multiply_intervals(factors[i], factors[i + width], _precision);
+                }
+            }
+
+            this->_approximation_interval = std::move(factors.front());
+            this->_refinement.operands_case = -1;
+        }
+
+        /**
+         * @brief Computes the interval of an INTEGER_POWER from the interval of its base, with
+         * the powers rounded outwards to the current precision (see detail::rounded_power), so
+         * that the bounds do not grow n-fold in length at every refinement. The exponent is
+         * evaluated and decoded the first time only. Exponents that do not fit in an unsigned
+         * long long are applied exactly.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_power_interval(real_operation<T> &ro) {
+            if (!_power_exponent) {
+                const_precision_iterator<T> &rhs = ro.get_rhs_itr();
+                rhs.iterate_n_times(rhs.maximum_precision());
+
+                const exact_number<T> &exponent = rhs.get_interval().upper_bound;
+                if (rhs.get_interval().lower_bound != exponent || (int) exponent.digits.size() > exponent.exponent) {
+                    throw non_integral_exponent_exception();
+                }
+                if (!exponent.positive) {
+                    throw negative_integers_not_supported();
+                }
+
+                std::vector<T> exponent_vector = exponent.digits, quotient, remainder;
+                exponent_vector.resize(std::max<size_t>(exponent_vector.size(), exponent.exponent), 0);
+                exact_number<T>::division_by_single_digit(exponent_vector, std::vector<T> {2}, quotient, remainder);
+                bool even = std::all_of(remainder.cbegin(), remainder.cend(), [](T digit) { return digit == 0; });
+                _power_exponent = power_exponent {exponent, exponent.as_unsigned_long_long(), even};
+            }
+
+            const power_exponent &exponent = *_power_exponent;
+            auto power = [this, &exponent](const exact_number<T> &bound, bool upper) {
+                if (exponent.machine_value) {
+                    return detail::rounded_power(bound, *exponent.machine_value, _precision, upper);
+                }
+                return exact_number<T>::binary_exponentiation(bound.abs(), exponent.value);
+            };
+
+            const interval<T> &base = ro.get_lhs_itr().get_interval();
+            exact_number<T> lower;
+            exact_number<T> upper;
+            if (base.positive()) {
+                lower = power(base.lower_bound, false);
+                upper = power(base.upper_bound, true);
+            } else if (base.negative()) {
+                if (exponent.even) {
+                    lower = power(base.upper_bound, false);
+                    upper = power(base.lower_bound, true);
+                } else {
+                    lower = detail::negated(power(base.lower_bound, true));
+                    upper = detail::negated(power(base.upper_bound, false));
+                }
+            } else if (exponent.even) {
+                lower = exact_number<T>();
+                upper = power(std::max(base.lower_bound.abs(), base.upper_bound.abs()), true);
+            } else {
+                lower = detail::negated(power(base.lower_bound, true));
+                upper = power(base.upper_bound, true);
+            }
+
+            this->_approximation_interval.lower_bound = std::move(lower);
+            this->_approximation_interval.upper_bound = std::move(upper);
+        }
+
+        /**
+         * @brief Computes the interval of a SIN (sine = true) or COS from the bounds of its operand
+         * reduced modulo pi / 2 (see detail::reduce_angle). Both functions are monotone between
+         * consecutive multiples n pi / 2, so the interval is that of the values at the bounds,
+         * widened to 1 or -1 for every multiple between them where the function reaches it:
+         * sin at n = 1 and n = 3 (mod 4), cos at n = 0 and n = 2. A multiple too close to a bound
+         * to tell on which side it lies is counted in.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::update_sin_cos_interval(real_operation<T> &ro, bool sine) {
+            const interval<T> &x = ro.get_lhs_itr().get_interval();
+            auto [lower, upper] = detail::parallel_bounds(thread_pool,
+                [&] { return detail::reduce_angle(x.lower_bound.up_to(_precision, false), _precision); },
+                [&] { return detail::reduce_angle(x.upper_bound.up_to(_precision, true), _precision); });
+
+            // the multiples n pi / 2 within the interval are first, ..., last
+            exact_number<T> first = lower.quarters;
+            int first_quadrant = lower.quadrant;
+            if (lower.remainder > lower.error) {
+                first = first + literals::one_exact<T>;
+                first_quadrant = (first_quadrant + 1) % 4;
+            }
+            exact_number<T> last = upper.quarters;
+            if (upper.remainder < detail::negated(upper.error)) {
+                last = last - literals::one_exact<T>;
+            }
+
+            const int maximum_quadrant = sine ? 1 : 0;
+            bool maximum = false;
+            bool minimum = false;
+            if (!(last < first)) {
+                if (last - first >= detail::exact_integer<T>(3)) {
+                    maximum = minimum = true;
+                } else {
+                    int quadrant = first_quadrant;
+                    for (exact_number<T> n = first; n <= last; n = n + literals::one_exact<T>) {
+                        maximum = maximum || quadrant == maximum_quadrant;
+                        minimum = minimum || quadrant == (maximum_quadrant + 2) % 4;
+                        quadrant = (quadrant + 1) % 4;
+                    }
+                }
+            }
+
+            this->_approximation_interval.lower_bound = minimum ? literals::minus_one_exact<T> :
+                std::min(lower.bound(sine, _precision, false), upper.bound(sine, _precision, false));
+            this->_approximation_interval.upper_bound = maximum ? literals::one_exact<T> :
+                std::max(lower.bound(sine, _precision, true), upper.bound(sine, _precision, true));
+        }
+
+        /**
+         * @brief Updates the interval of the SUM or PRODUCT ro, whose last operand was just added,
+         * with that operand only, so that a chain of += or *= does not recompute the operation
+         * from all its operands at every step. The operand is first refined to the precision of
+         * the operation, as the operands of an operation always are.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::add_last_operand(real_operation<T> &ro) {
+            const_precision_iterator<T> &operand = ro.get_operand_itr(ro.operand_count() - 1);
+            if (operand._precision < _precision) {
+                operand.iterate_n_times(_precision - operand._precision);
+            }
+
+            interval<T> truncated;
+            {
+                std::lock_guard<std::recursive_mutex> lock(operand.mutex());
+                truncated = detail::truncated_interval(operand.get_interval(), _precision);
+            }
+            if (ro.get_operation() == OPERATION::SUM) {
+                this->_approximation_interval.lower_bound = this->_approximation_interval.lower_bound + truncated.lower_bound;
+                this->_approximation_interval.upper_bound = this->_approximation_interval.upper_bound + truncated.upper_bound;
+            } else {
+                this->_approximation_interval = detail::multiply_intervals(this->_approximation_interval, truncated, _precision);
+            }
+
+            // the intervals cached so far are those of the operation without the operand
+            if (_cache != nullptr) {
+                _cache = std::make_shared<interval_cache<T>>();
+            }
+            this->_refinement = refinement_state();
+        }
+
         /// determines a real_operation's approximation interval from its operands'
+        /// sin and cos of the truncated bounds of x, computed in parallel when there is a thread_pool
+        template <typename T>
+        inline std::pair<std::tuple<exact_number<T>, exact_number<T>>, std::tuple<exact_number<T>, exact_number<T>>>
+        const_precision_iterator<T>::sin_cos_bounds(const interval<T> &x) const {
+            return detail::parallel_bounds(thread_pool,
+                [&] { return sin_cos(x.lower_bound.up_to(_precision, false), _precision, false); },
+                [&] { return sin_cos(x.upper_bound.up_to(_precision, true), _precision, true); });
+        }
+
         template <typename T>
         inline void const_precision_iterator<T>::update_operation_boundaries(real_operation<T> &ro) {
             switch (ro.get_operation()) {
                 case OPERATION::ADDITION:
-                    this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) +
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-
-                    this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) +
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                    update_operation_interval(ro, 0);
                     break;
 
-
                 case OPERATION::SUBTRACTION:
-                    this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) -
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
-                    this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) -
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                    update_operation_interval(ro, 1);
                     break;
 
                 case OPERATION::MULTIPLICATION: {
@@ -86,41 +542,15 @@ namespace boost {
                     bool rhs_negative = ro.get_rhs_itr().get_interval().negative();
 
                     if (lhs_positive && rhs_positive) { // Positive - Positive
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
+                        update_operation_interval(ro, 2);
                     } else if (lhs_negative && rhs_negative) { // Negative - Negative
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        update_operation_interval(ro, 3);
                     } else if (lhs_negative && rhs_positive) { // Negative - Positive
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-
+                        update_operation_interval(ro, 4);
                     } else if (lhs_positive && rhs_negative) { // Positive - Negative
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
+                        update_operation_interval(ro, 5);
                     } else { // One is around zero all possible combinations are be tested
+                        this->_refinement.operands_case = -1;
 
                         exact_number<T> current_boundary;
 
@@ -275,80 +705,15 @@ namespace boost {
 
                     break;
                 }
-                case OPERATION::INTEGER_POWER: {
-                    ro.get_rhs_itr().iterate_n_times(ro.get_rhs_itr().maximum_precision());
-
-                    if (ro.get_rhs_itr().get_interval().lower_bound != ro.get_rhs_itr().get_interval().upper_bound ||
-                        (int) ro.get_rhs_itr().get_interval().lower_bound.digits.size() > ro.get_rhs_itr().get_interval().lower_bound.exponent) {
-                        throw non_integral_exponent_exception();
-                    }
-
-                    if(ro.get_rhs_itr().get_interval().upper_bound.positive == false){
-                        throw negative_integers_not_supported();
-                    }
-
-                    exact_number<T> exponent = ro.get_rhs_itr().get_interval().upper_bound, _2, zero = exact_number<T> (), tmp;
-                    _2.digits = {2};
-                    _2.exponent = 1;
-
-                    std::vector<T> exponent_vector, quotient, remainder;
-                    exponent_vector = exponent.digits;
-                    while ((int) exponent_vector.size() < exponent.exponent) {
-                        exponent_vector.push_back(0);
-                    }
-
-                    tmp.division_by_single_digit(exponent_vector, std::vector<T> {2}, quotient, remainder);
-
-                    bool exponent_is_even = false;
-
-                    if (remainder.empty()) {
-                        exponent_is_even = true;
-                    }
-
-                    if (ro.get_lhs_itr().get_interval().positive()) {
-                        this->_approximation_interval.upper_bound = 
-                                tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().upper_bound, exponent);
-                        this->_approximation_interval.lower_bound =
-                                tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().lower_bound, exponent);
-                    } else if (ro.get_lhs_itr().get_interval().negative()) {
-                        if (exponent_is_even) {
-                            this->_approximation_interval.upper_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().lower_bound, exponent);
-                            this->_approximation_interval.lower_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().upper_bound, exponent);
-                        } else {
-                            this->_approximation_interval.upper_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().upper_bound, exponent);
-                            this->_approximation_interval.lower_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().lower_bound, exponent);
-                        }
-                    } else {
-                        if (exponent_is_even) {
-                            if (ro.get_lhs_itr().get_interval().upper_bound.abs() > ro.get_lhs_itr().get_interval().lower_bound.abs()) {
-                                this->_approximation_interval.upper_bound =
-                                        tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().upper_bound, exponent);
-                                this->_approximation_interval.lower_bound = zero;
-                            } else {
-                                this->_approximation_interval.upper_bound =
-                                        tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().lower_bound, exponent);
-                                this->_approximation_interval.lower_bound = zero;
-                            }
-                        } else {
-                            this->_approximation_interval.upper_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().upper_bound, exponent);
-                            this->_approximation_interval.lower_bound =
-                                    tmp.binary_exponentiation(ro.get_lhs_itr().get_interval().lower_bound, exponent);
-                        }
-                    }
-
+                case OPERATION::INTEGER_POWER:
+                    update_power_interval(ro);
                     break;
-                }
 
                 case OPERATION::EXPONENT :{
-                    this->_approximation_interval.lower_bound = 
-                        exponent(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    this->_approximation_interval.upper_bound = 
-                        exponent(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                    const interval<T> &lhs = ro.get_lhs_itr().get_interval();
+                    std::tie(this->_approximation_interval.lower_bound, this->_approximation_interval.upper_bound) = detail::parallel_bounds(thread_pool,
+                        [&] { return exponent(lhs.lower_bound.up_to(_precision, false), _precision, false); },
+                        [&] { return exponent(lhs.upper_bound.up_to(_precision, true), _precision, true); });
                     break;
                 }
 
@@ -357,9 +722,10 @@ namespace boost {
                     if(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true).positive == false){
                         throw logarithm_not_defined_for_non_positive_number();
                     }
-                    // now if we get our lower bound as negative, then we iterate for more precise input, until maximum precision is reached or we get positive lower bound
+                    // now if we get our lower bound as negative, then we iterate for more precise input, until maximum precision is reached or we get positive lower bound.
+                    // The lower bound is checked as it is rounded down for logarithm, which can turn 1.000... into 0 at a low precision.
                     while(true){
-                        if(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, true) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, true).positive == false){
+                        if(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) == literals::zero_exact<T> || ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false).positive == false){
                             if(_precision >= ro.get_lhs_itr().maximum_precision()){
                                         throw logarithm_not_defined_for_non_positive_number();
                             }
@@ -368,241 +734,20 @@ namespace boost {
                         }
                         else break;
                     }
-                    this->_approximation_interval.lower_bound = 
-                        logarithm(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    this->_approximation_interval.upper_bound = 
-                        logarithm(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                    const interval<T> &lhs = ro.get_lhs_itr().get_interval();
+                    std::tie(this->_approximation_interval.lower_bound, this->_approximation_interval.upper_bound) = detail::parallel_bounds(thread_pool,
+                        [&] { return logarithm(lhs.lower_bound.up_to(_precision, false), _precision, false); },
+                        [&] { return logarithm(lhs.upper_bound.up_to(_precision, true), _precision, true); });
                     break;
                 }
 
-                case OPERATION::SIN :{
-                    /** 
-                     * First we ensure that our input interval is greater than 2π or not. We can either check that by comparing the difference
-                     * of upper and lower bound with 2π or a number greater than 2π. We will check whether the difference is greater than 8 or not.
-                     * If the difference is greater than 8 then we are sure that difference is greater than 2π. We are not using π here for checking because
-                     * algorithm for π is very complex and checking with that number will be very inefficient.
-                     * The condition of difference between 2π and 8 will be checked in next case. Here we will only check whether our number is
-                     * greater than 8 or not. If it is, then we will give hardcoded output of [-1, 1] because the result can be anything between -1 to 1.
-                     **/
-                    if(ro.get_lhs_itr().get_interval().upper_bound - ro.get_lhs_itr().get_interval().lower_bound >= literals::eight_exact<T>){
-                        this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                        this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                        break;
-                    }
-                    /**
-                     * Now we will check whether the difference is greater than 4 or not.
-                     * 4 is greater than π, so we are sure that there is at least one minima/maxima.
-                     * But there can exist both minima and maxima, as input can be anywhere between [4,8).
-                     * So, we will check sign of derivative of sin, which is cos. If there is one minima/maxima, sign of derivative
-                     * will change once, so we will different signs of derivative on upper and lower bound. If there are both minima and maxima,
-                     * sign of derivative will change twice, so at the end, sign of derivative in both upper and lower bound will remain same.
-                     **/
-                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
-                    if(ro.get_lhs_itr().get_interval().upper_bound - ro.get_lhs_itr().get_interval().lower_bound >= literals::four_exact<T>){
-                        /**
-                         * If sign of derivative, which cos(x), if it is same for both upper and lower bound. Then we will return 
-                         * hardcoded output [-1, 1].
-                         **/
-                        if(cos_upper.positive == cos_lower.positive){
-                            this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                            this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                        }
-                        /**
-                         * Now, the sign was changed, then there is either one minima/maxima or three maxima minima.
-                         * There can exist either one minima/maxima or three points of maxima. In case of three points of maxima, and 
-                         * difference between inputs less than 8, both ends of sin will have same sign and sin(x) of mid point of upper and 
-                         * lower bound will have oppsite sign from end points. In that case, we will give hard coded output [-1, 1]. 
-                         **/
-                        else{
-                            auto mid = ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) + ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
-                            if(sin_lower.positive == sin_upper.positive 
-                                && sine(mid, _precision, true).positive == sin_upper.positive){
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            /**
-                             * We will check sign of lower bound of derivative, if it is positive, then initially function was increasing
-                             * then it would have gone up to 1 and then started decresing. So, the output will be [min(sin(upper_bound, sin(lower_bounf))), 1].
-                            **/
-                            else if(cos_lower.positive){
-                                this->_approximation_interval.lower_bound = std::min(sin_upper, sin_lower);
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            /**
-                             * Now if the sign of derivaye is negative, then initially function was decreasing. So, the function would have got to -1 and then again 
-                             * started incresing. So, the output should be [-1, max(sin_lower, cos_lower)].
-                             **/
-                            else{
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = std::max(sin_upper, sin_lower);
-                            }
-                        }
-                    }
-                    /**
-                     * Now, the final case, the difference is less than 4.
-                     * There are two possibilities, no maxima/minima or one maxima/minima.
-                     * If sign of derivative changes, then one maxima/minima, if it doesn't, then no maxima/minima
-                     **/
-                    else{
-                        /**
-                         * If sign does not changes, then no maxima/minima or both maxima and minima.
-                         * We will check sign of derivative at mid of interval, if it is not same as that of lower and upper bounds.
-                         * Then we have both maxima and minima.
-                         **/
-                        if(cos_upper.positive == cos_lower.positive){
-                             // if sign of derivative at mid point is not same as at end points then both minima and maxima are there
-                            auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
-                            if(cosine(mid, _precision, true).positive != cos_lower.positive){
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            // If cos(x), which is derivative of sin(x), is positive, then function was increasing in that interval. So, the output will be [sin_lower, sin_upper].
-                            else if(cos_lower.positive){
-                                this->_approximation_interval.lower_bound = sin_lower;
-                                this->_approximation_interval.upper_bound = sin_upper;
-                            }
-                            // If it is negative, then function was decreasing in that interval. SO, the output will be [sin_upper, sin_lower].
-                            else{
-                                this->_approximation_interval.lower_bound = sin_upper;
-                                this->_approximation_interval.upper_bound = sin_lower;
-                            }
-                        }
-                        /**
-                         * If sign changes, then one maxima/minima. So, we will check sign of derivative at lower bound of input.
-                         * If it is positive, then function was increasing initially. So, the output will be [min(sin_lower, sin_upper), 1].
-                         * If it is negative, then function was decreasing initially. So, the output will be [-1, max(sin_upper, sin_lower)].
-                         **/
-                        else{
-                            if(cos_lower.positive){
-                                this->_approximation_interval.lower_bound = std::min(sin_lower, sin_upper);
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            else{
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = std::max(sin_lower, sin_upper);
-                            }
-                        }
-
-                    }
+                case OPERATION::SIN :
+                    update_sin_cos_interval(ro, true);
                     break;
-                }
-
-                case OPERATION::COS :{
-                    /** 
-                     * First we ensure that our input interval is greater than 2π or not. We can either check that by comparing the difference
-                     * of upper and lower bound with 2π or a number greater than 2π. We will check whether the difference is greater than 8 or not.
-                     * If the difference is greater than 8 then we are sure that difference is greater than 2π. We are not using π here for checking because
-                     * algorithm for π is very complex and checking with that number will be very inefficient.
-                     * The condition of difference between 2π and 8 will be checked in next case. Here we will only check whether our number is
-                     * greater than 8 or not. If it is, then we will give hardcoded output of [-1, 1] because the result can be anything between -1 to 1.
-                     **/
-                    if(ro.get_lhs_itr().get_interval().upper_bound - ro.get_lhs_itr().get_interval().lower_bound >= literals::eight_exact<T>){
-                        this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                        this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                        break;
-                    }
-                    /**
-                     * Now we will check whether the difference is greater than 4 or not.
-                     * 4 is greater than π, so we are sure that there is at least one minima/maxima.
-                     * But there can exist both minima and maxima, as input can be anywhere between [4,8).
-                     * So, we will check sign of derivative of cos(x), which is -sin(x). If there is one minima/maxima, sign of derivative
-                     * will change once, so we will different signs of derivative on upper and lower bound. If there are both minima and maxima,
-                     * sign of derivative will change twice, so at the end, sign of derivative in both upper and lower bound will remain same.
-                     **/
-                    auto [sin_lower, cos_lower] = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                    auto [sin_upper, cos_upper] = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
-                    if(ro.get_lhs_itr().get_interval().upper_bound - ro.get_lhs_itr().get_interval().lower_bound >= literals::four_exact<T>){
-                        /**
-                         * If sign of derivative, which -sin(x), if it is same for both upper and lower bound. Then we will return 
-                         * hardcoded output [-1, 1].
-                         **/
-                        if(sin_upper.positive == sin_lower.positive){
-                            this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                            this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                        }
-                        /**
-                         * Now, the sign of deriavtive is changed, then there is either one minima/maxima or three maxima minima.
-                         * There can exist either one minima/maxima or three points of maxima. In case of three points of maxima, 
-                         * difference between inputs less than 8, both ends of cos(x) will have same sign and cos(x) of mid point of upper and 
-                         * lower bound will have oppsite sign from end points. In that case, we will give hard coded output [-1, 1]. 
-                         **/
-                        else{
-                            auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
-                            if(cos_lower.positive == cos_upper.positive 
-                                && cosine(mid, _precision, true).positive == cos_upper.positive){
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            /**
-                             * We will check sign of lower bound of sin(x), if it is negative, then initially function was increasing
-                             * then it would have gone up to 1 and then started decresing. So, the output will be [min(cos(upper_bound, cos(lower_bounf))), 1].
-                            **/
-                            else if(!sin_lower.positive){
-                                this->_approximation_interval.lower_bound = std::min(cos_upper, cos_lower);
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            /**
-                             * Now if the sign of cos(lower_bound) is positive, then initially function was decreasing. So, the function would have got to -1 and then again 
-                             * started incresing. So, the output should be [-1, max(cos_lower, cos_lower)].
-                             **/
-                            else{
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = std::max(cos_upper, cos_lower);
-                            }
-                        }
-                    }
-                    /**
-                     * Now, the final case, the difference is less than 4.
-                     * There are three possibilities, no maxima/minima or one maxima/minima or both maxima and minima.
-                     **/
-                    else{
-                        /**
-                         * If sign does not changes, then no maxima/minima or both maxima and minima.
-                         * We will check sign of derivative at mid of interval, if it is not same as that of lower and upper bounds.
-                         * Then we have both maxima and minima.
-                         **/
-                        if(sin_upper.positive == sin_lower.positive){
-                            // if sign of derivative at mid point is not same as at end points then both minima and maxima are there
-                            auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
-                            if(sine(mid, _precision, true).positive != sin_lower.positive){
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            // If -sin(x), which is derivative of cos(x), is positive, then function was increasing in that interval. So, the output will be [cos_lower, cos_upper].
-                            else if(!sin_lower.positive){
-                                this->_approximation_interval.lower_bound = cos_lower;
-                                this->_approximation_interval.upper_bound = cos_upper;
-                            }
-                            // If it is negative, then function was decreasing in that interval. SO, the output will be [cos_upper, cos_lower].
-                            else{
-                                this->_approximation_interval.lower_bound = cos_upper;
-                                this->_approximation_interval.upper_bound = cos_lower;
-                            }
-                        }
-                        /**
-                         * If sign changes, then one maxima/minima. So, we will check sign of derivative at lower bound of input.
-                         * If it is positive, then function was increasing initially. So, the output will be [min(sin_lower, sin_upper), 1].
-                         * If it is negative, then function was decreasing initially. So, the output will be [-1, max(sin_upper, sin_lower)].
-                         **/
-                        else{
-                            if(!sin_lower.positive){
-                                this->_approximation_interval.lower_bound = std::min(cos_lower, cos_upper);
-                                this->_approximation_interval.upper_bound = literals::one_exact<T>;
-                            }
-                            else{
-                                this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
-                                this->_approximation_interval.upper_bound = std::max(cos_lower, cos_upper);
-                            }
-                        }
 
-                    }
+                case OPERATION::COS :
+                    update_sin_cos_interval(ro, false);
                     break;
-                }
 
                 case OPERATION::TAN :{
                     // we will keep on iterating until we get our interval in domain of tan(x)
@@ -616,8 +761,9 @@ namespace boost {
                             iterate_again = true;
                         }
                         else{
-                            std::tie(sin_lower_tmp, cos_lower_tmp) = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                            std::tie(sin_upper_tmp, cos_upper_tmp) = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                            auto [lower, upper] = sin_cos_bounds(ro.get_lhs_itr().get_interval());
+                            std::tie(sin_lower_tmp, cos_lower_tmp) = lower;
+                            std::tie(sin_upper_tmp, cos_upper_tmp) = upper;
                             /**
                              * Now if difference between lower and upper bounds of interval is less than 4, then there can exist 0,1 or 2 minima/maxima points.
                              * First we will check whether the sign of cos(x) from lower to upper bound is changed or not, if it is, then we have one point 
@@ -675,8 +821,9 @@ namespace boost {
                             iterate_again = true;
                         }
                         else{
-                            std::tie(sin_lower_tmp, cos_lower_tmp) = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                            std::tie(sin_upper_tmp, cos_upper_tmp) = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                            auto [lower, upper] = sin_cos_bounds(ro.get_lhs_itr().get_interval());
+                            std::tie(sin_lower_tmp, cos_lower_tmp) = lower;
+                            std::tie(sin_upper_tmp, cos_upper_tmp) = upper;
                             /**
                              * Now if difference between lower and upper bounds of interval is less than 4, then there can exist 0,1 or 2 minima/maxima points.
                              * First we will check whether the sign of sin(x) from lower to upper bound is changed or not, if it is, then we have one point 
@@ -736,8 +883,9 @@ namespace boost {
                             iterate_again = true;
                         }
                         else{
-                            std::tie(sin_lower_tmp, cos_lower_tmp) = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                            std::tie(sin_upper_tmp, cos_upper_tmp) = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                            auto [lower, upper] = sin_cos_bounds(ro.get_lhs_itr().get_interval());
+                            std::tie(sin_lower_tmp, cos_lower_tmp) = lower;
+                            std::tie(sin_upper_tmp, cos_upper_tmp) = upper;
                             /**
                              * Now if difference between lower and upper bounds of interval is less than 4, then there can exist 0,1 or 2 minima/maxima points.
                              * First we will check whether the sign of cos(x) from lower to upper bound is changed or not, if it is, then we have one point 
@@ -837,8 +985,9 @@ namespace boost {
                             iterate_again = true;
                         }
                         else{
-                            std::tie(sin_lower_tmp, cos_lower_tmp) = sin_cos(ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false), _precision, false);
-                            std::tie(sin_upper_tmp, cos_upper_tmp) = sin_cos(ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true), _precision, true);
+                            auto [lower, upper] = sin_cos_bounds(ro.get_lhs_itr().get_interval());
+                            std::tie(sin_lower_tmp, cos_lower_tmp) = lower;
+                            std::tie(sin_upper_tmp, cos_upper_tmp) = upper;
                             /**
                              * Now if difference between lower and upper bounds of interval is less than 4, then there can exist 0,1 or 2 minima/maxima points.
                              * First we will check whether the sign of sin(x) from lower to upper bound is changed or not, if it is, then we have one point 
@@ -928,44 +1077,516 @@ namespace boost {
                     break;
                 }
 
+                case OPERATION::SUM:
+                    update_sum_interval(ro);
+                    break;
+
+                case OPERATION::PRODUCT:
+                    update_product_interval(ro);
+                    break;
+
                 default:
                     throw boost::real::none_operation_exception();
             }
         }
 
+        /**
+         * @brief Returns the nodes of the operation tree below ro that are less precise than target,
+         * in the order they have to be refined: every node comes after its operands.
+         *
+         * The tree is walked in post-order with an explicit stack, so its depth is not limited
+         * by the call stack. An operand shared by several operations (the tree is a DAG) is
+         * listed only once, the first time it is reached.
+         */
+        template <typename T>
+        inline std::vector<typename const_precision_iterator<T>::refinement_step>
+        const_precision_iterator<T>::refinement_order(real_operation<T> &ro, precision_t target) {
+            struct frame {
+                refinement_step step;
+                size_t next_operand;
+            };
+
+            std::vector<refinement_step> order;
+            std::unordered_set<const const_precision_iterator<T>*> visited;
+            std::vector<frame> stack = {{{this, &ro}, 0}};
+
+            while (!stack.empty()) {
+                frame &top = stack.back();
+
+                if (top.next_operand == top.step.operation->operand_count()) {
+                    order.push_back(top.step);
+                    stack.pop_back();
+                    continue;
+                }
+
+                const_precision_iterator<T> &operand = top.step.operation->get_operand_itr(top.next_operand++);
+
+                if (operand._precision >= target || !visited.insert(&operand).second) {
+                    continue;
+                }
+
+                // top is invalidated by the push_back, it is not used after this point
+                if (auto operand_operation = std::get_if<real_operation<T>>(operand._real_ptr.get())) {
+                    stack.push_back({{&operand, operand_operation}, 0});
+                } else {
+                    order.push_back({&operand, nullptr});
+                }
+            }
+
+            return order;
+        }
+
+        /**
+         * @brief Refines a node of an operation tree up to target, see operation_iterate_n_times.
+         * Only the node and its operands are locked, and a node another evaluation already
+         * refined up to target meanwhile is left as it is, so intervals never lose precision.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::refine_step(refinement_step &step, precision_t target) {
+            if (step.operation == nullptr) {
+                std::lock_guard<std::recursive_mutex> lock(step.itr->mutex());
+                if (step.itr->_precision < target) {
+                    step.itr->iterate_n_times(target - step.itr->_precision);
+                }
+                return;
+            }
+
+            auto guard = step.itr->lock_operands(*step.operation);
+            if (step.itr->_precision >= target) {
+                return;
+            }
+
+            if (step.itr == this) {
+                this->_precision = target;
+                update_operation_boundaries(*step.operation);
+                cache_interval();
+            } else if (!step.itr->restore_cached_interval(target)) {
+                // only the iterated number caches its interval, copying the interval of every
+                // node would cost more than refining it
+                step.itr->_precision = target;
+                step.itr->update_operation_boundaries(*step.operation);
+            }
+        }
+
+        /**
+         * @brief Iterates the operation n times: every node below it that is less precise than the
+         * new precision is refined exactly once, up to that precision, before the nodes that
+         * depend on it. Operands therefore always have at least the precision of their operation.
+         */
         template <typename T>
         inline void const_precision_iterator<T>::operation_iterate_n_times(real_operation<T> &ro, int n) {
-            /// @warning there could be issues if operands have different precisions/max precisions
+            precision_t target = this->_precision + n;
+            {
+                std::lock_guard<std::recursive_mutex> lock(mutex());
+                if (this->_precision >= target || restore_cached_interval(target)) {
+                    return;
+                }
+            }
 
-            if (ro.get_lhs_itr()._precision < this->_precision + n) {
-                ro.get_lhs_itr().iterate_n_times(n);
+            // a step holding the locks of a whole tree cannot wait for the pool, whose waiting
+            // thread runs the pending tasks of other evaluations, which may need those locks
+            std::vector<refinement_step> order = refinement_order(ro, target);
+            if (thread_pool != nullptr && order.size() > 2 && !detail::evaluation_guard::nested()) {
+                parallel_refine(order, target);
+                return;
             }
-            
-            if (ro.get_rhs_itr()._precision < this->_precision + n) {
-                ro.get_rhs_itr().iterate_n_times(n);
+
+            for (refinement_step &step : order) {
+                refine_step(step, target);
             }
+        }
 
-            this->_precision += n;
+        /**
+         * @brief Refines the nodes of order on the thread_pool. A node only depends on nodes of
+         * lower levels, so the nodes of the same level are refined concurrently, level after
+         * level. The nodes that refine their own operands lock the whole tree below them, which
+         * the other nodes of their level would wait for, so they run on the calling thread once
+         * the rest of their level is done. Every step takes its own locks, see refine_step.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::parallel_refine(std::vector<refinement_step> &order, precision_t target) {
+            std::unordered_map<const const_precision_iterator<T>*, size_t> level_of;
+            std::vector<std::vector<refinement_step*>> levels;
+
+            for (refinement_step &step : order) {
+                size_t level = 0;
+                if (step.operation != nullptr) {
+                    for (size_t i = 0; i < step.operation->operand_count(); ++i) {
+                        auto operand_level = level_of.find(&step.operation->get_operand_itr(i));
+                        if (operand_level != level_of.end()) {
+                            level = std::max(level, operand_level->second + 1);
+                        }
+                    }
+                }
 
-            update_operation_boundaries(ro);
+                level_of[step.itr] = level;
+                if (levels.size() <= level) {
+                    levels.resize(level + 1);
+                }
+                levels[level].push_back(&step);
+            }
+
+            for (std::vector<refinement_step*> &nodes : levels) {
+                std::vector<refinement_step*> parallel_nodes;
+                std::vector<refinement_step*> serial_nodes;
+                for (refinement_step *step : nodes) {
+                    if (step->operation != nullptr && detail::refines_operands(step->operation->get_operation())) {
+                        serial_nodes.push_back(step);
+                    } else {
+                        parallel_nodes.push_back(step);
+                    }
+                }
+
+                // a few tasks per worker, so that the workers stay busy when the nodes are uneven
+                size_t tasks = std::min(parallel_nodes.size(), thread_pool->size() * 4);
+                if (tasks > 1) {
+                    task_group group(*thread_pool);
+                    for (size_t task = 0; task < tasks; ++task) {
+                        group.run([this, &parallel_nodes, task, tasks, target] {
+                            for (size_t i = task; i < parallel_nodes.size(); i += tasks) {
+                                refine_step(*parallel_nodes[i], target);
+                            }
+                        });
+                    }
+                    group.wait();
+                } else if (tasks == 1) {
+                    refine_step(*parallel_nodes[0], target);
+                }
+
+                for (refinement_step *step : serial_nodes) {
+                    refine_step(*step, target);
+                }
+            }
         }
 
+        /**
+         * @brief Moves the iterator to an interval another iterator of the same number already
+         * computed at precision, if it is cached. The next iteration then recomputes the interval
+         * from the operands instead of refining it, as the refinement state belongs to the
+         * interval that was replaced.
+         */
         template <typename T>
-        inline void const_precision_iterator<T>::operation_iterate(real_operation<T> &ro) {
-            // only iterate if we must. If operand precision < this precision, then it must have
-            // hit its maximum_precision. If operand precision == this precision, we try iterating. Otherwise,
-            // it is == this->_precision + 1 (from being iterated elsewhere in the operation tree) and
-            // we do not iterate again.
+        inline bool const_precision_iterator<T>::restore_cached_interval(precision_t precision) {
+            if (_cache == nullptr) {
+                return false;
+            }
 
-            if (ro.get_lhs_itr()._precision == this->_precision)
-                ++(ro.get_lhs_itr());
-            
-            if (ro.get_rhs_itr()._precision == this->_precision)
-                ++(ro.get_rhs_itr());
+            std::optional<interval<T>> cached = _cache->find(precision);
+            if (!cached) {
+                return false;
+            }
 
-            (this->_precision)++;
+            _approximation_interval = std::move(*cached);
+            _precision = precision;
+            _refinement = refinement_state();
+            return true;
+        }
 
-            update_operation_boundaries(ro);
+        template <typename T>
+        inline void const_precision_iterator<T>::cache_interval() {
+            if (_cache != nullptr) {
+                _cache->insert(_precision, _approximation_interval);
+            }
+        }
+
+        namespace detail {
+            /// a base exponent below the exponent of any number, used as the magnitude of zero
+            constexpr int MAGNITUDE_OF_ZERO = std::numeric_limits<int>::min() / 4;
+
+            /// the smallest e such that |x| < base^e for every x in the interval
+            template <typename T>
+            int magnitude_exponent(const interval<T> &i) {
+                auto exponent = [](const exact_number<T> &bound) {
+                    bool zero = std::all_of(bound.digits.cbegin(), bound.digits.cend(), [](T digit) { return digit == 0; });
+                    return zero ? MAGNITUDE_OF_ZERO : bound.exponent;
+                };
+                return std::max(exponent(i.lower_bound), exponent(i.upper_bound));
+            }
+
+            /// the smallest e such that count <= base^e, the digits lost adding up count errors
+            template <typename T>
+            int count_exponent(size_t count) {
+                const size_t base = (std::numeric_limits<T>::max() / 4) * 2 - 1;
+                int exponent = 0;
+                for (size_t power = 1; power < count; ++exponent) {
+                    power = (power > std::numeric_limits<size_t>::max() / base) ? count : power * base;
+                }
+                return exponent;
+            }
+
+            /// the largest e such that base^e <= |x| for every x in the interval, if the interval does not contain zero
+            template <typename T>
+            std::optional<int> minimum_magnitude_exponent(const interval<T> &i) {
+                if (!i.positive() && !i.negative()) {
+                    return std::nullopt;
+                }
+                const exact_number<T> &closest = i.positive() ? i.lower_bound : i.upper_bound;
+                if (std::all_of(closest.digits.cbegin(), closest.digits.cend(), [](T digit) { return digit == 0; })) {
+                    return std::nullopt;
+                }
+                return closest.exponent - 1;
+            }
+        }
+
+        /**
+         * @brief Refines the tree below this iterator so that its interval is about base^error_exponent
+         * wide, giving each node only the precision its contribution to the error needs.
+         *
+         * The error allowed for the root is pushed down the tree using the current intervals: the
+         * operands of an addition get the same error, a multiplication scales the error of each
+         * operand by the magnitude of the other, the operands of a sum or a product share its
+         * error, a division scales it by the magnitude of the divisor, and
+         * the functions by a bound of their derivative. Every node is then refined, operands
+         * first, to the precision that its allowed error and its operand truncations need. Nodes
+         * are never made less precise and the precisions are capped by maximum_precision().
+         * The magnitudes are read once per node, under its lock, and every node is then refined
+         * by its own refine_step.
+         *
+         * @param error_exponent - the exponent, in the number base, of the allowed error.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::refine_to_error(int error_exponent) {
+            const int max_precision = (int) this->maximum_precision();
+            auto precision_for = [max_precision](int precision) {
+                return (precision_t) std::clamp(precision, 1, max_precision);
+            };
+
+            auto root_operation = std::get_if<real_operation<T>>(_real_ptr.get());
+            if (root_operation == nullptr) {
+                std::lock_guard<std::recursive_mutex> lock(mutex());
+                precision_t target = precision_for(detail::magnitude_exponent(_approximation_interval) - error_exponent);
+                if (target > _precision) {
+                    this->iterate_n_times(target - _precision);
+                }
+                return;
+            }
+
+            std::vector<refinement_step> order = refinement_order(*root_operation, std::numeric_limits<precision_t>::max());
+
+            // the magnitudes of |x| and, when the interval does not contain zero, of its lower bound
+            struct node_magnitude {
+                int magnitude;
+                std::optional<int> minimum;
+            };
+            std::unordered_map<const const_precision_iterator<T>*, node_magnitude> node_magnitudes;
+            for (refinement_step &step : order) {
+                std::lock_guard<std::recursive_mutex> lock(step.itr->mutex());
+                node_magnitudes[step.itr] = {detail::magnitude_exponent(step.itr->_approximation_interval),
+                                        detail::minimum_magnitude_exponent(step.itr->_approximation_interval)};
+            }
+            auto magnitude_of = [&node_magnitudes](const const_precision_iterator<T> &node) {
+                return node_magnitudes.at(&node).magnitude;
+            };
+
+            std::unordered_map<const const_precision_iterator<T>*, int> allowed_error = {{this, error_exponent}};
+            std::unordered_map<const const_precision_iterator<T>*, int> target_precision;
+
+            // an operand shared by several nodes gets the smallest error they allow
+            auto allow = [&allowed_error](const const_precision_iterator<T> *operand, int operand_error) {
+                auto allowed = allowed_error.find(operand);
+                if (allowed == allowed_error.end()) {
+                    allowed_error[operand] = operand_error;
+                } else {
+                    allowed->second = std::min(allowed->second, operand_error);
+                }
+            };
+
+            // parents come after their operands in order, so walking it backwards pushes the errors down
+            for (auto step = order.rbegin(); step != order.rend(); ++step) {
+                const_precision_iterator<T> &node = *step->itr;
+                const int error = allowed_error.at(&node);
+                const int magnitude = magnitude_of(node);
+
+                if (step->operation == nullptr) {
+                    target_precision[&node] = magnitude - error;
+                    continue;
+                }
+
+                if (is_n_ary(step->operation->get_operation())) {
+                    real_operation<T> &operation = *step->operation;
+                    // the errors of the operands add up, so each of them gets a share of the error
+                    const int shares = detail::count_exponent<T>(operation.operand_count());
+
+                    // d(a_1 * ... * a_n) = sum of the da_i times the other operands
+                    int magnitudes = 0;
+                    if (operation.get_operation() == OPERATION::PRODUCT) {
+                        for (size_t i = 0; i < operation.operand_count(); ++i) {
+                            magnitudes += std::max(magnitude_of(operation.get_operand_itr(i)), 0);
+                        }
+                    }
+
+                    // the partial products are rounded to the node precision, and are at most as large as magnitudes
+                    int precision = std::max(magnitude, magnitudes) - error + shares;
+                    for (size_t i = 0; i < operation.operand_count(); ++i) {
+                        const_precision_iterator<T> &operand = operation.get_operand_itr(i);
+                        const int operand_magnitude = magnitude_of(operand);
+                        int operand_error = error - 1 - shares;
+                        if (operation.get_operation() == OPERATION::PRODUCT) {
+                            operand_error -= magnitudes - std::max(operand_magnitude, 0);
+                        }
+
+                        allow(&operand, operand_error);
+                        precision = std::max(precision, operand_magnitude - operand_error);
+                    }
+                    target_precision[&node] = precision + 1;
+                    continue;
+                }
+
+                // the unary operations have no rhs, whose error then never matters
+                const_precision_iterator<T> &lhs = step->operation->get_lhs_itr();
+                const_precision_iterator<T> *rhs = is_unary(step->operation->get_operation()) ? nullptr : &step->operation->get_rhs_itr();
+                const int lhs_magnitude = magnitude_of(lhs);
+                const int rhs_magnitude = (rhs == nullptr) ? detail::MAGNITUDE_OF_ZERO : magnitude_of(*rhs);
+                auto lower_magnitude = [max_precision, &node_magnitudes](const const_precision_iterator<T> &operand, int magnitude) {
+                    // an interval around zero is assumed to be as close to zero as it can be represented
+                    return node_magnitudes.at(&operand).minimum.value_or(magnitude - max_precision);
+                };
+
+                // one guard digit per operation absorbs the truncations of the node itself
+                int lhs_error = error - 1;
+                int rhs_error = error - 1;
+                bool absolute_precision = true;
+
+                switch (step->operation->get_operation()) {
+                    case OPERATION::ADDITION:
+                    case OPERATION::SUBTRACTION:
+                        absolute_precision = false;
+                        break;
+
+                    case OPERATION::MULTIPLICATION:
+                        // d(a * b) = b * da + a * db
+                        lhs_error -= std::max(rhs_magnitude, 0);
+                        rhs_error -= std::max(lhs_magnitude, 0);
+                        absolute_precision = false;
+                        break;
+
+                    case OPERATION::DIVISION: {
+                        // d(a / b) = da / b - a * db / b^2
+                        int divisor = lower_magnitude(*rhs, rhs_magnitude);
+                        lhs_error += std::min(divisor, 0);
+                        rhs_error += std::min(2 * divisor - std::max(lhs_magnitude, 0), 0);
+                        break;
+                    }
+
+                    case OPERATION::INTEGER_POWER:
+                        // d(a^n) = n * a^n / a * da, the exponent is always evaluated exactly
+                        lhs_error -= std::max(magnitude - lower_magnitude(lhs, lhs_magnitude) + std::max(rhs_magnitude, 0), 0);
+                        break;
+
+                    case OPERATION::EXPONENT:
+                        // d(e^a) = e^a * da
+                        lhs_error -= std::max(magnitude, 0);
+                        break;
+
+                    case OPERATION::LOGARITHM:
+                        // d(log(a)) = da / a
+                        lhs_error += std::min(lower_magnitude(lhs, lhs_magnitude), 0);
+                        break;
+
+                    case OPERATION::SIN:
+                    case OPERATION::COS:
+                        // |d(sin(a))|, |d(cos(a))| <= |da|
+                        break;
+
+                    default:
+                        // |d(tan(a))| = 1 + tan(a)^2, and the other functions are bounded by the square of their value
+                        lhs_error -= 2 * std::max(magnitude, 1);
+                }
+
+                allow(&lhs, lhs_error);
+                if (rhs != nullptr) {
+                    allow(rhs, rhs_error);
+                }
+
+                // the node truncates its operands to its own precision, relative to their magnitude
+                int precision = std::max({magnitude - error, lhs_magnitude - lhs_error, rhs_magnitude - rhs_error});
+                if (absolute_precision) {
+                    precision = std::max(precision, -error);
+                }
+                target_precision[&node] = precision + 1;
+            }
+
+            for (refinement_step &step : order) {
+                precision_t target = precision_for(target_precision.at(step.itr));
+                if (target > step.itr->_precision) {
+                    refine_step(step, target);
+                }
+            }
+        }
+
+        /**
+         * @brief Locks this iterator and every operand below it, which are all the iterators
+         * refining this node may read or refine, unless the current thread already holds them.
+         * Only the operations that refine their own operands need it, see lock_operands.
+         */
+        template <typename T>
+        inline detail::evaluation_guard const_precision_iterator<T>::lock_tree() {
+            if (detail::evaluation_guard::nested()) {
+                return detail::evaluation_guard();
+            }
+
+            std::vector<std::recursive_mutex*> mutexes;
+            std::unordered_set<const const_precision_iterator<T>*> visited;
+            std::vector<const_precision_iterator<T>*> stack = {this};
+
+            while (!stack.empty()) {
+                const_precision_iterator<T> *itr = stack.back();
+                stack.pop_back();
+                if (!visited.insert(itr).second) {
+                    continue;
+                }
+
+                mutexes.push_back(&itr->mutex());
+                if (auto operation = std::get_if<real_operation<T>>(itr->_real_ptr.get())) {
+                    for (size_t i = 0; i < operation->operand_count(); ++i) {
+                        stack.push_back(&operation->get_operand_itr(i));
+                    }
+                }
+            }
+
+            return detail::evaluation_guard(std::move(mutexes));
+        }
+
+        /**
+         * @brief Locks this iterator and the operands of ro, which is enough to compute an interval
+         * that only reads them. The operations that refine their own operands lock the whole tree
+         * below them instead, as they may refine any node of it.
+         */
+        template <typename T>
+        inline detail::evaluation_guard const_precision_iterator<T>::lock_operands(real_operation<T> &ro) {
+            if (detail::evaluation_guard::nested()) {
+                return detail::evaluation_guard();
+            }
+            if (detail::refines_operands(ro.get_operation())) {
+                return lock_tree();
+            }
+
+            std::vector<std::recursive_mutex*> mutexes;
+            mutexes.reserve(ro.operand_count() + 1);
+            mutexes.push_back(&mutex());
+            for (size_t i = 0; i < ro.operand_count(); ++i) {
+                mutexes.push_back(&ro.get_operand_itr(i).mutex());
+            }
+            return detail::evaluation_guard(std::move(mutexes));
+        }
+
+        /**
+         * @brief Moves the operands of the iterated operation into operands, unless the operation
+         * is shared with copies of this iterator, which still need them.
+         */
+        template <typename T>
+        inline void const_precision_iterator<T>::release_operands(std::vector<std::shared_ptr<real_data<T>>> &operands) {
+            if (_real_ptr.use_count() == 1) {
+                if (auto operation = std::get_if<real_operation<T>>(_real_ptr.get())) {
+                    operation->release_operands(operands);
+                }
+            }
+        }
+
+        template <typename T>
+        inline void const_precision_iterator<T>::operation_iterate(real_operation<T> &ro) {
+            // operands already iterated elsewhere in the operation tree are skipped by the schedule
+            operation_iterate_n_times(ro, 1);
         }
 
         /* real_operation member functions */
@@ -981,6 +1602,14 @@ namespace boost {
         inline const_precision_iterator<T>& real_operation<T>::get_rhs_itr() {
             return _rhs->get_precision_itr();
         }
+
+        template <typename T>
+        inline const_precision_iterator<T>& real_operation<T>::get_operand_itr(size_t i) {
+            if (is_n_ary(_operation)) {
+                return _operands[i]->get_precision_itr();
+            }
+            return (i == 0) ? _lhs->get_precision_itr() : _rhs->get_precision_itr();
+        }
     }
 }
 
@@ -67,6 +67,12 @@ namespace boost {
             }
         };
 
+        struct limb_literal_overflow_exception : public std::exception {
+            const char * what () const throw () override {
+                return "The literal does not fit in the number of limbs reserved for it";
+            }
+        };
+
         struct octal_input_not_supported_exception : public std::exception {
 
             const char * what () const throw () override {
@@ -141,6 +147,12 @@ namespace boost {
                 return "Square root function is not defined for negative numbers";
             }
         };
+
+        struct non_positive_target_error_exception : public std::exception {
+            const char * what() const throw () override {
+                return "The target error of an evaluation must be positive";
+            }
+        };
         
 
     }
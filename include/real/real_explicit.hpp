@@ -174,6 +174,14 @@ namespace boost {
                
             }
 
+            /**
+             * @brief Creates a boost::real::real_explicit from an already normalized
+             * boost::real::exact_number, without any base conversion.
+             *
+             * @param number - the boost::real::exact_number to represent.
+             */
+            explicit real_explicit(exact_number<T> number) : explicit_number(std::move(number)) {};
+
             // constructor to convert an integer type rational number into an explicit number
             constexpr explicit real_explicit(integer_number<T> num){
                 int _exponent = 0;
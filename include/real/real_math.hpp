@@ -1,219 +1,491 @@
 #ifndef BOOST_REAL_MATH_HPP
 #define BOOST_REAL_MATH_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <tuple>
+#include <vector>
 #include "real/exact_number.hpp"
+#include "real/constants.hpp"
 #include "real/real_exception.hpp"
 
 namespace boost{
 	namespace real{
+		namespace detail {
+			/// number truncated toward zero to precision significant digits
+			template<typename T>
+			exact_number<T> significant(exact_number<T> number, size_t precision){
+				number.normalize_left();
+				return truncated(number, precision);
+			}
+
+			/**
+			 * @brief: number / divisor truncated toward zero to precision significant digits, by a
+			 * single pass of long division over the digits of number. The base of 64 bit digits is
+			 * about 2^62, so remainder * base does not fit in an unsigned long long: with
+			 * base = base_quotient * divisor + base_remainder and digit = digit_quotient * divisor + digit_remainder,
+			 * (remainder * base + digit) / divisor = remainder * base_quotient + digit_quotient
+			 * + (remainder * base_remainder + digit_remainder) / divisor, where every term fits.
+			 * @param: divisor: 0 < divisor < 2^32
+			 **/
+			template<typename T>
+			exact_number<T> divide_by(const exact_number<T> &number, unsigned long long divisor, size_t precision){
+				const unsigned long long base = constant_base<T>();
+				const unsigned long long base_quotient = base / divisor;
+				const unsigned long long base_remainder = base % divisor;
+				exact_number<T> quotient(std::vector<T>(precision + 2), number.exponent, number.positive);
+				unsigned long long remainder = 0;
+				for(size_t i = 0; i < precision + 2; ++i){
+					const unsigned long long digit = (i < number.digits.size()) ? (unsigned long long) number.digits[i] : 0;
+					const unsigned long long low = remainder * base_remainder + digit % divisor;
+					quotient.digits[i] = (T) (remainder * base_quotient + digit / divisor + low / divisor);
+					remainder = low % divisor;
+				}
+				return significant(quotient, precision);
+			}
+
+			/**
+			 * @brief: the sum of w^n / (c(1) ... c(n)) for n < terms, by rectangular splitting: the sum is
+			 * S_0, with S_j = (sum_{i < m} w^i P_{j,i} + w^m S_{j + 1}) / (c(jm + 1) ... c(jm + m)), where
+			 * P_{j,i} = c(jm + i + 1) ... c(jm + m) and S_J = 0 for the first block J past the terms. With
+			 * m about sqrt(terms), it costs 2 sqrt(terms) full products, the others being products and
+			 * divisions by small integers.
+			 * @param: factor: c, with 0 < c(l) < 2^32 for l <= terms + sqrt(terms)
+			 * @param: error: increased by the truncation errors of the sum, in units of base^-(precision - 1),
+			 * for |w| well below 1
+			 **/
+			template<typename T, typename Factor>
+			exact_number<T> rectangular_series(const exact_number<T> &w, unsigned long long terms, Factor factor, size_t precision, unsigned long long &error){
+				const unsigned long long m = std::max<unsigned long long>(1, (unsigned long long) std::sqrt((double) terms));
+				const unsigned long long blocks = (terms + m - 1) / m;
+				std::vector<exact_number<T> > w_powers = {literals::one_exact<T>};
+				for(unsigned long long i = 1; i <= m; ++i){
+					w_powers.push_back(significant(w_powers.back() * w, precision));
+				}
+
+				exact_number<T> result;
+				for(unsigned long long j = blocks; j-- > 0;){
+					exact_number<T> sum = significant(w_powers[m] * result, precision);
+					exact_number<T> coefficient = literals::one_exact<T>;
+					for(unsigned long long i = m; i-- > 0;){
+						coefficient = coefficient * exact_integer<T>(factor(j * m + i + 1));
+						sum = significant(sum + w_powers[i] * coefficient, precision);
+					}
+					for(unsigned long long i = 1; i <= m; ++i){
+						sum = divide_by(sum, factor(j * m + i), precision);
+					}
+					result = sum;
+				}
+				error += 2 * ((3 * m + 3) * blocks + m + 4);
+				return result;
+			}
+
+			/// -number, keeping zero positive
+			template<typename T>
+			exact_number<T> negated(exact_number<T> number){
+				if(!std::all_of(number.digits.cbegin(), number.digits.cend(), [](T digit) { return digit == 0; })){
+					number.positive = !number.positive;
+				}
+				return number;
+			}
+
+			/// an approximation of number as a double, infinite when it does not fit in one
+			template<typename T>
+			double approximate(const exact_number<T> &number){
+				double mantissa = 0;
+				double scale = 1;
+				for(size_t i = 0; i < number.digits.size() && i < 3; ++i){
+					scale /= constant_base<T>();
+					mantissa += number.digits[i] * scale;
+				}
+				double value = mantissa * std::pow((double) constant_base<T>(), number.exponent);
+				return number.positive ? value : -value;
+			}
+		}
+
 		/**
-		 *  EXPONENT FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates exponent of a exact_number using taylor expansion
+		 *  EXPONENT FUNCTION USING ARGUMENT REDUCTION AND RECTANGULAR SPLITTING
+		 * @brief: calculates exponent of a exact_number. x is reduced to r = x - k ln(2), with the
+		 * ln(2) of boost::real::constants, and r to y = r / 2^s, so that e^x = 2^k (e^y)^(2^s). The
+		 * taylor series of e^y then converges quickly, and is evaluated by rectangular splitting:
+		 * its terms are summed in blocks of m, every block costing one full product and 2m products
+		 * and divisions by small integers, instead of a full product and a full division by k! per
+		 * term. Every step is truncated to a working precision, and the truncation errors are added
+		 * to the result, in the direction asked, before rounding it.
 		 * @param: num: the exact number. whose exponent is to be found
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
-		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
-		 * @author: Vikram Singh Chundawat
+		 * @param: max_error_exponent: the number of significant digits of the result
+		 * @param:  upper: if true: the result is above e^num, else it is below it
 		 **/
 		template<typename T>
 		exact_number<T> exponent(exact_number<T> num, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
-			exact_number<T> term_number("1");
-			exact_number<T> factorial("1");
-			exact_number<T> cur_term("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			exact_number<T> x_pow("1");
-			do{
-				result += cur_term;
-				factorial *= term_number;
-				term_number = term_number + literals::one_exact<T>;
-				x_pow *= num;
-				cur_term = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			if(num == literals::zero_exact<T>){
+				return literals::one_exact<T>;
+			}
+			const double x = detail::approximate(num);
+			if(!(std::abs(x) < 1e10)){
+				throw exponent_overflow_exception();
+			}
+
+			// e^x = 2^k e^r
+			const long long k = std::llround(x / std::log(2.0));
+			const unsigned long long k_abs = (unsigned long long) std::abs(k);
+			size_t k_digits = 0;
+			for(unsigned long long rest = k_abs; rest != 0; rest /= detail::constant_base<T>()){
+				++k_digits;
+			}
+			const size_t precision = max_error_exponent + k_digits + 5;
+
+			exact_number<T> r = num;
+			if(k != 0){
+				exact_number<T> ln2 = constants<T>::shared().get(CONSTANT::LN2, precision + k_digits, false);
+				exact_number<T> k_exact = detail::exact_integer<T>(k_abs);
+				k_exact.positive = (k > 0);
+				r = num - k_exact * ln2;
+			}
+			r = detail::significant(r, precision);
+
+			// e^r = (e^y)^(2^s), with |y| below about 2^-halvings
+			const double bits = precision * std::log2((double) detail::constant_base<T>());
+			const int halvings = std::min(std::max((int) std::sqrt(bits), 8), 24);
+			const double r_approximation = std::abs(detail::approximate(r));
+			int s = 0;
+			if(r_approximation > 0){
+				s = std::max(0, halvings + (int) std::ceil(std::log2(r_approximation)));
+			}
+			exact_number<T> y = (s > 0) ? detail::divide_by(r, 1ULL << s, precision) : r;
+
+			// the terms y^n / n!, n < N, leave a tail below base^-(precision + 1)
+			const double y_bound = std::abs(detail::approximate(y)) * 1.01;
+			unsigned long long terms = 1;
+			if(y_bound > 0){
+				const double target = -(precision + 1.0) * std::log((double) detail::constant_base<T>()) - std::log(4.0);
+				while(terms * std::log(y_bound) - std::lgamma(terms + 1.0) > target){
+					++terms;
+				}
+			}
+
+			unsigned long long error = 3;
+			exact_number<T> result = detail::rectangular_series(y, terms, [](unsigned long long l) { return l; }, precision, error);
+
+			// the error of every truncated step, in units of base^-(precision - 1) times the result
+			for(int i = 0; i < s; ++i){
+				result.square();
+				result = detail::significant(result, precision);
+				error = 2 * error + 1;
+			}
+			if(k != 0){
+				const exact_number<T> two_power = exact_number<T>::sliding_window_power(
+					(k > 0) ? literals::two_exact<T> : exact_number<T>(std::vector<T> {detail::constant_base<T>() / 2}, 0, true),
+					k_abs,
+					[precision](exact_number<T> &&power) { return detail::significant(power, precision); });
+				result = detail::significant(result * two_power, precision);
+				error += 2 * k_abs + 3;
+			}
+
+			exact_number<T> bound = detail::exact_integer<T>(error) * exact_number<T>(std::vector<T> {1}, result.exponent - (int) precision + 3, true);
+			result = upper ? result + bound : result - bound;
+			return result.up_to(max_error_exponent, upper);
 		}
 
 		/**
-		 *  LOGARITHM(BASE e) FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates log(base e) of a exact_number using taylor expansion
+		 *  LOGARITHM(BASE e) FUNCTION USING ARGUMENT REDUCTION AND THE ATANH SERIES
+		 * @brief: calculates log(base e) of a exact_number. x is reduced to z = x / 2^k, with z
+		 * between 1 / sqrt(2) and sqrt(2), so that log(x) = k ln(2) + 2 atanh(u), with the ln(2) of
+		 * boost::real::constants and u = (z - 1) / (z + 1) below 0.172. The series of atanh(u) / u
+		 * in v = u^2 is then evaluated by rectangular splitting, every block of m terms costing one
+		 * full product and m divisions by small integers, and u takes the only reciprocal. Every
+		 * step is truncated to a working precision, and the truncation errors are added to the
+		 * result, in the direction asked, before rounding it.
 		 * @param: x: the exact number. whose logarithm (ln(x)) is to be found
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
-		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
-		 * @author: Vikram Singh Chundawat
+		 * @param: max_error_exponent: the number of significant digits of the result
+		 * @param:  upper: if true: the result is above ln(x), else it is below it
 		 **/
 		template<typename T>
 		exact_number<T> logarithm(exact_number<T> x, size_t max_error_exponent, bool upper){
 			// log is only defined for numbers greater than 0
-			static const exact_number<T> two("2");
 			if(x == literals::zero_exact<T> || x.positive == false){
 				throw logarithm_not_defined_for_non_positive_number();
 			}
-			exact_number<T> result("0");
-			exact_number<T> term_number("1");
-			unsigned int term_number_int = 1;
-			exact_number<T> cur_term("0");
-			exact_number<T> x_pow ("1");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			
-			if(x > literals::zero_exact<T> && x < two){
-				do{
-					if(term_number_int %2 == 1)
-						result -= cur_term;
-					else 
-						result += cur_term;	
-					x_pow = x_pow * (x - literals::one_exact<T>);
-					cur_term = x_pow;
-					cur_term.divide_vector(term_number, max_error_exponent, upper);
-					++term_number_int;
-					term_number = term_number + literals::one_exact<T>;
-				}while(cur_term.abs() > max_error);
-				return result;
+			if(x == literals::one_exact<T>){
+				return literals::zero_exact<T>;
 			}
+			x.normalize();
 
-			do{
-				result += cur_term;
-				x_pow = x_pow * (x - literals::one_exact<T>);
-				x_pow.divide_vector(x, max_error_exponent, upper);
-				cur_term = x_pow ;
-				cur_term.divide_vector(term_number, max_error_exponent, upper);
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			// log2(x), from the leading digits and the exponent of x
+			const double log2_base = std::log2((double) detail::constant_base<T>());
+			double mantissa = 0;
+			double scale = 1;
+			for(size_t i = 0; i < x.digits.size() && i < 3; ++i){
+				scale /= detail::constant_base<T>();
+				mantissa += x.digits[i] * scale;
+			}
+			const long long k = std::llround(std::log2(mantissa) + x.exponent * log2_base);
+			const unsigned long long k_abs = (unsigned long long) std::abs(k);
+			size_t k_digits = 0;
+			for(unsigned long long rest = k_abs; rest != 0; rest /= detail::constant_base<T>()){
+				++k_digits;
+			}
+			const size_t precision = max_error_exponent + k_digits + 4;
+
+			// z = x / 2^k
+			exact_number<T> z = x;
+			if(k != 0){
+				const exact_number<T> two_power = exact_number<T>::sliding_window_power(
+					(k < 0) ? literals::two_exact<T> : exact_number<T>(std::vector<T> {detail::constant_base<T>() / 2}, 0, true),
+					k_abs,
+					[precision](exact_number<T> &&power) { return detail::significant(power, precision); });
+				z = detail::significant(z * two_power, precision);
+			}
+
+			// u = (z - 1) / (z + 1)
+			exact_number<T> u = z - literals::one_exact<T>;
+			u.normalize();
+			exact_number<T> series;
+			unsigned long long error = 0;
+			if(u != literals::zero_exact<T>){
+				exact_number<T> denominator = detail::significant(z + literals::one_exact<T>, precision + 1);
+				u = detail::significant(u * detail::exact_reciprocal(denominator, precision + 1), precision);
+				const exact_number<T> v = detail::significant(u * u, precision);
+
+				// the terms v^n / (2n + 1), n < N, leave a tail below base^-(precision + 1)
+				const double v_bound = std::abs(detail::approximate(v)) * 1.01;
+				unsigned long long terms = 1;
+				if(v_bound > 0){
+					const double target = -(precision + 1.0) * std::log((double) detail::constant_base<T>());
+					terms = std::max<unsigned long long>(1, (unsigned long long) std::ceil(target / std::log(v_bound)));
+				}
+
+				// sum_n v^n / (2n + 1) = sum_j v^(jm) sum_{i < m} v^i / (2(jm + i) + 1), by horner in v^m
+				const unsigned long long m = std::max<unsigned long long>(1, (unsigned long long) std::sqrt((double) terms));
+				const unsigned long long blocks = (terms + m - 1) / m;
+				std::vector<exact_number<T> > v_powers = {literals::one_exact<T>};
+				for(unsigned long long i = 1; i <= m; ++i){
+					v_powers.push_back(detail::significant(v_powers.back() * v, precision));
+				}
+				for(unsigned long long j = blocks; j-- > 0;){
+					exact_number<T> sum = detail::significant(v_powers[m] * series, precision);
+					for(unsigned long long i = m; i-- > 0;){
+						sum = detail::significant(sum + detail::divide_by(v_powers[i], 2 * (j * m + i) + 1, precision), precision);
+					}
+					series = sum;
+				}
+				series = detail::significant(u * series * literals::two_exact<T>, precision);
+				error = 2 * ((2 * m + 2) * blocks + 2 * m + 8);
+			}
+
+			// the error of every truncated step, in units of base^-(precision - 1) times u, or times 1 if x was reduced
+			int error_exponent = (k == 0) ? u.exponent : 0;
+			exact_number<T> result = series;
+			if(k != 0){
+				exact_number<T> ln2 = constants<T>::shared().get(CONSTANT::LN2, precision + k_digits, false);
+				exact_number<T> k_exact = detail::exact_integer<T>(k_abs);
+				k_exact.positive = (k > 0);
+				result = result + k_exact * ln2;
+				error += 2 * k_abs + 6;
+			}
+
+			exact_number<T> bound = detail::exact_integer<T>(error) * exact_number<T>(std::vector<T> {1}, error_exponent - (int) precision + 2, true);
+			result = upper ? result + bound : result - bound;
+			return result.up_to(max_error_exponent, upper);
+		}
+
+		namespace detail {
+			/// x = quarters pi / 2 + remainder, with sin(x) and cos(x) from the remainder
+			template<typename T>
+			struct reduced_angle {
+				/// the nearest integer to x / (pi / 2)
+				exact_number<T> quarters;
+				/// quarters mod 4
+				int quadrant = 0;
+				/// x - quarters pi / 2, about within [-pi / 4, pi / 4]
+				exact_number<T> remainder;
+				exact_number<T> sin;
+				exact_number<T> cos = literals::one_exact<T>;
+				/// a bound of the absolute error of remainder, sin and cos
+				exact_number<T> error;
+
+				/// sin(x) (or cos(x), if sine is false) rounded down or up to precision significant digits
+				exact_number<T> bound(bool sine, size_t precision, bool upper) const {
+					exact_number<T> result = sine ? sin : cos;
+					result = upper ? result + error : result - error;
+					return result.up_to(precision, upper);
+				}
+			};
+
+			/// the quarters q nearest to x / half_pi, from the reciprocal of half_pi, with |x| < base^integer_digits
+			template<typename T>
+			exact_number<T> nearest_quarters(const exact_number<T> &x, const exact_number<T> &half_pi, size_t integer_digits){
+				exact_number<T> ratio = significant(x, integer_digits + 2) * exact_reciprocal(half_pi, integer_digits + 2);
+				ratio.normalize();
+				const T half = constant_base<T>() / 2;
+				if(ratio.exponent <= 0){
+					if(ratio.exponent < 0 || ratio.digits.empty() || ratio.digits[0] < half){
+						return exact_number<T>();
+					}
+					return exact_number<T>(std::vector<T> {1}, 1, ratio.positive);
+				}
+
+				const size_t integer_size = (size_t) ratio.exponent;
+				const bool round_up = integer_size < ratio.digits.size() && ratio.digits[integer_size] >= half;
+				ratio.digits.resize(integer_size, 0);
+				if(round_up){
+					ratio = ratio + exact_number<T>(std::vector<T> {1}, 1, ratio.positive);
+				}
+				ratio.normalize();
+				return ratio;
+			}
+
+			/**
+			 * @brief: x reduced modulo pi / 2, x = q pi / 2 + r, with the pi of boost::real::constants to
+			 * as many digits as the integer part of x and the precision need. sin(r) and cos(r) are
+			 * computed from r / 2^j, with |r / 2^j| below 2^-8, by the series in -(r / 2^j)^2 with
+			 * rectangular splitting, and j doublings sin(2a) = 2 sin(a) cos(a), cos(2a) = 1 - 2 sin(a)^2.
+			 * They are then mapped back by the quadrant q mod 4. A remainder r close to 0 is computed
+			 * again with as many more digits of pi as it has leading zeros, so that sin(x) keeps
+			 * precision significant digits near the multiples of pi.
+			 * @param: precision: the number of significant digits of the results
+			 **/
+			template<typename T>
+			reduced_angle<T> reduce_angle(exact_number<T> x, size_t precision){
+				reduced_angle<T> angle;
+				x.normalize();
+				if(x == literals::zero_exact<T>){
+					return angle;
+				}
+
+				// |x| < base^integer_digits, so |q| pi / 2 has integer_digits + 1 digits before the point
+				const size_t integer_digits = (size_t) std::max(x.exponent, 0);
+				size_t working_precision = precision + 4;
+				auto remainder = [&](){
+					exact_number<T> half_pi = constants<T>::shared().get(CONSTANT::PI, working_precision + integer_digits + 2, false);
+					half_pi = half_pi * exact_number<T>(std::vector<T> {constant_base<T>() / 2}, 0, true);
+					if(angle.quarters.digits.empty()){
+						angle.quarters = nearest_quarters(x, half_pi, integer_digits);
+					}
+					exact_number<T> r = angle.quarters.digits.empty() ? x : x - angle.quarters * half_pi;
+					r.normalize();
+					return r;
+				};
+				angle.remainder = remainder();
+				if(angle.remainder != literals::zero_exact<T> && angle.remainder.exponent < 0){
+					working_precision += (size_t) -angle.remainder.exponent;
+					if(!angle.quarters.digits.empty()){
+						angle.remainder = remainder();
+					}
+				}
+				angle.remainder = significant(angle.remainder, working_precision);
+
+				// q mod 4, from the last two digits of q, as base = 2 (mod 4)
+				if(!angle.quarters.digits.empty()){
+					const int size = (int) angle.quarters.digits.size();
+					const int exponent = angle.quarters.exponent;
+					auto digit = [&](int i) { return (i >= 0 && i < size) ? (int) (angle.quarters.digits[i] % 4) : 0; };
+					angle.quadrant = (digit(exponent - 1) + 2 * digit(exponent - 2)) % 4;
+					if(!angle.quarters.positive){
+						angle.quadrant = (4 - angle.quadrant) % 4;
+					}
+				}
+
+				// the error of every truncated step, in units of base^-(working_precision - 1), with 2 for r
+				const double bits = working_precision * std::log2((double) constant_base<T>());
+				const int halvings = std::min(std::max((int) std::sqrt(bits) / 2, 8), 12);
+				const double r_approximation = std::abs(approximate(angle.remainder));
+				int j = 0;
+				if(r_approximation > 0){
+					j = std::max(0, halvings + (int) std::ceil(std::log2(r_approximation)));
+				}
+				const exact_number<T> y = (j > 0) ? divide_by(angle.remainder, 1ULL << j, working_precision) : angle.remainder;
+				exact_number<T> w = significant(y * y, working_precision);
+				w.positive = false;
+
+				// the terms y^2n / (2n)!, n < N, leave a tail below base^-(working_precision + 1)
+				const double y_bound = std::abs(approximate(y)) * 1.01;
+				unsigned long long terms = 1;
+				if(y_bound > 0){
+					const double target = -(working_precision + 1.0) * std::log((double) constant_base<T>()) - std::log(4.0);
+					while(2 * terms * std::log(y_bound) - std::lgamma(2 * terms + 1.0) > target){
+						++terms;
+					}
+				}
+
+				unsigned long long error = 4;
+				exact_number<T> sin = rectangular_series(w, terms, [](unsigned long long l) { return (2 * l) * (2 * l + 1); }, working_precision, error);
+				sin = significant(y * sin, working_precision);
+				exact_number<T> cos = rectangular_series(w, terms, [](unsigned long long l) { return (2 * l - 1) * (2 * l); }, working_precision, error);
+				for(int i = 0; i < j; ++i){
+					const exact_number<T> sin_square = significant(sin * sin, working_precision);
+					sin = significant(sin * cos * literals::two_exact<T>, working_precision);
+					cos = significant(literals::one_exact<T> - sin_square * literals::two_exact<T>, working_precision);
+					error = 4 * error + 3;
+				}
+				error += 2;
+
+				switch(angle.quadrant){
+					case 0:
+						angle.sin = sin;
+						angle.cos = cos;
+						break;
+					case 1:
+						angle.sin = cos;
+						angle.cos = negated(sin);
+						break;
+					case 2:
+						angle.sin = negated(sin);
+						angle.cos = negated(cos);
+						break;
+					default:
+						angle.sin = negated(cos);
+						angle.cos = sin;
+				}
+				angle.error = exact_integer<T>(error) * exact_number<T>(std::vector<T> {1}, 2 - (int) working_precision, true);
+				return angle;
+			}
 		}
 
 		/**
-		 *  SINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates sin(x) of a exact_number using taylor expansion
+		 *  SINE FUNCTION USING ARGUMENT REDUCTION
+		 * @brief: calculates sin(x) of a exact_number, from x reduced modulo pi / 2 (see
+		 * detail::reduce_angle), so that large arguments do not go through a series whose terms
+		 * first grow as x^n / n!
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
-		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @param: max_error_exponent: the number of significant digits of the result
+		 * @param:  upper: if true: the result is above sin(x), else it is below it
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
 		exact_number<T> sine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("0");
-			exact_number<T> term_number("0");
-			unsigned int term_number_int = 0;
-			exact_number<T> cur_term(x);
-			exact_number<T> x_pow(x);
-			exact_number<T> factorial("1");
-			exact_number<T> tmp;
-			exact_number<T> x_square = x*x;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			static exact_number<T> two("2");
-			
-			do{
-				if(term_number_int % 2 == 0){ // if this term is even
-					result += cur_term;
-				}
-				else 
-					result -= cur_term; // if this term is odd
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-				x_pow *= x_square; // increasing power by two powers of original x
-				factorial = factorial * ( two * term_number) * ( (two * term_number) + literals::one_exact<T>); // increasing the values of factorial by two
-				cur_term  = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			return detail::reduce_angle(x, max_error_exponent).bound(true, max_error_exponent, upper);
 		}
 
 		/**
-		 *  COSINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates cos(x) of a exact_number using taylor expansion
+		 *  COSINE FUNCTION USING ARGUMENT REDUCTION
+		 * @brief: calculates cos(x) of a exact_number, from x reduced modulo pi / 2 (see
+		 * detail::reduce_angle)
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
-		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @param: max_error_exponent: the number of significant digits of the result
+		 * @param:  upper: if true: the result is above cos(x), else it is below it
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
 		exact_number<T> cosine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
-			exact_number<T> cur_term("0");
-			exact_number<T> square_x = x*x;
-			exact_number<T> cur_power("1");
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> term_number("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			int term_number_int = 0;
-			do{
-				if(term_number_int % 2 == 0)
-					result += cur_term;
-				else 
-					result -= cur_term;
-				
-				for(exact_number<T> i = (two * term_number) + literals::one_exact<T> ; i <= two * (term_number + literals::one_exact<T>); i = i + literals::one_exact<T>){
-					factorial *= i;
-				}
-				cur_power *= square_x;
-				cur_term = cur_power;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-				++ term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-				
-			}while(cur_term.abs() > max_error);
-			result = result.up_to(max_error_exponent, upper);
-			return result;
+			return detail::reduce_angle(x, max_error_exponent).bound(false, max_error_exponent, upper);
 		}
 
 		 
 		 /**
-		 *  SINE AND COSINE FUNCTION USING TAYLOR EXPANSION
-		 * @brief: calculates cos(x) and sin(x) of a exact_number using taylor expansion
+		 *  SINE AND COSINE FUNCTION USING ARGUMENT REDUCTION
+		 * @brief: calculates cos(x) and sin(x) of a exact_number, from a single reduction of x modulo
+		 * pi / 2 (see detail::reduce_angle)
 		 * @param: x: the exact_number, representing angle in radian
-		 * @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
-		 * @param:  upper: if true: error lies in [0, +epsilon]
-		 *                  else: error lies in [-epsilon, 0], here epsilon = 1*base^(-max_error_exponent)
+		 * @param: max_error_exponent: the number of significant digits of the results
+		 * @param:  upper: if true: the results are above sin(x) and cos(x), else they are below them
 		 * @return: a tuple containing sin(x) and cos(x)
 		 * @author: Vikram Singh Chundawat
 		 **/
 		template<typename T>
 		std::tuple<exact_number<T>, exact_number<T> > sin_cos(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> sin_result("0");
-			exact_number<T> cos_result("0");
-			exact_number<T> cur_sin_term = x;
-			exact_number<T> cur_cos_term("1");
-			exact_number<T> cur_power = x;
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> factorial_number("1");
-			unsigned int term_number_int = 0;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			do{
-
-				if(term_number_int % 2 == 0){
-					sin_result += cur_sin_term;
-					cos_result += cur_cos_term;
-				}
-				else{
-					sin_result -= cur_sin_term;
-					cos_result -= cur_cos_term;
-				}
-				++term_number_int;
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
-				cur_power *= x;
-				cur_cos_term = cur_power;
-				cur_cos_term.divide_vector(factorial, max_error_exponent, upper);
-
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
-				cur_power *= x;
-				cur_sin_term = cur_power;
-				cur_sin_term.divide_vector(factorial, max_error_exponent, upper);
-			}while( (cur_cos_term.abs() > max_error) || (cur_sin_term.abs() > max_error) );
-
-			return std::make_tuple(sin_result, cos_result);
+			const detail::reduced_angle<T> angle = detail::reduce_angle(x, max_error_exponent);
+			return std::make_tuple(angle.bound(true, max_error_exponent, upper), angle.bound(false, max_error_exponent, upper));
 		}
 
 		/**
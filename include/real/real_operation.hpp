@@ -1,7 +1,10 @@
 #ifndef BOOST_REAL_REAL_OPERATION
 #define BOOST_REAL_REAL_OPERATION
 
+#include <algorithm>
+#include <iterator>
 #include <memory> // shared_ptr
+#include <vector>
 
 #include <real/real_algorithm.hpp>
 #include <real/real_explicit.hpp>
@@ -17,17 +20,44 @@ namespace boost{
 
         /*
         * @brief real_operation is a (very unbalanced) binary tree representation of operations, where
-        * the leaves are the operands and the nodes store the type of operation
+        * the leaves are the operands and the nodes store the type of operation. SUM and PRODUCT are
+        * the n-ary additions and multiplications that += and *= build, so that chains of them
+        * stay one level deep.
         * 
-        * @warning due to the recursive nature of real_operation, destruction may cause stack overflow
+        * @note the operands are released iteratively when the tree is destroyed (see ~real_data),
+        * so deep trees do not overflow the stack
         */
-        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC}; 
+        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, INTEGER_POWER, EXPONENT, LOGARITHM, SIN, COS, TAN, COT, SEC, COSEC, SUM, PRODUCT}; 
+
+        /// true for the operations with any number of operands
+        inline bool is_n_ary(OPERATION op) {
+            return op == OPERATION::SUM || op == OPERATION::PRODUCT;
+        }
+
+        /// true for the functions of a single number, which have no rhs
+        inline bool is_unary(OPERATION op) {
+            switch (op) {
+                case OPERATION::EXPONENT:
+                case OPERATION::LOGARITHM:
+                case OPERATION::SIN:
+                case OPERATION::COS:
+                case OPERATION::TAN:
+                case OPERATION::COT:
+                case OPERATION::SEC:
+                case OPERATION::COSEC:
+                    return true;
+                default:
+                    return false;
+            }
+        }
 
         template <typename T = int>
         class real_operation{
         private:
             std::shared_ptr<real_data<T>> _lhs;
             std::shared_ptr<real_data<T>> _rhs;
+            // the operands of a SUM or PRODUCT, which have no lhs and rhs
+            std::vector<std::shared_ptr<real_data<T>>> _operands;
             OPERATION _operation;
 
         public:
@@ -40,6 +70,20 @@ namespace boost{
              */
             real_operation(std::shared_ptr<real_data<T>> &lhs, std::shared_ptr<real_data<T>> &rhs, OPERATION op) : _lhs(lhs), _rhs(rhs), _operation(op) {};
 
+            /*
+             * @brief Constructor of a function of a single number, such as OPERATION::SIN
+             * @param operand - the argument of the function, which is the lhs
+             * @param op  - an operation for which is_unary is true
+             */
+            real_operation(std::shared_ptr<real_data<T>> &operand, OPERATION op) : _lhs(operand), _operation(op) {};
+
+            /*
+             * @brief Constructor of a SUM or PRODUCT
+             * @param operands - the operands, at least two
+             * @param op  - OPERATION::SUM or OPERATION::PRODUCT
+             */
+            real_operation(std::vector<std::shared_ptr<real_data<T>>> operands, OPERATION op) : _operands(std::move(operands)), _operation(op) {};
+
             OPERATION get_operation() const {
                 return _operation;
             }
@@ -50,6 +94,18 @@ namespace boost{
             /// fwd decl'd, defined in real_data
             const_precision_iterator<T>& get_rhs_itr();
 
+            /// the number of operands, which is 2 for every operation but SUM, PRODUCT and the unary ones
+            size_t operand_count() const {
+                if (is_n_ary(_operation)) {
+                    return _operands.size();
+                }
+                return is_unary(_operation) ? 1 : 2;
+            }
+
+            /// fwd decl'd, defined in real_data. Operand 0 is lhs and operand 1 is rhs.
+            const_precision_iterator<T>& get_operand_itr(size_t i);
+
+            /// nullptr for the unary operations
             std::shared_ptr<real_data<T>> rhs() const {
                 return _rhs;
             }
@@ -57,6 +113,32 @@ namespace boost{
             std::shared_ptr<real_data<T>> lhs() const {
                 return _lhs;
             }
+
+            /// the operands of a SUM or PRODUCT
+            const std::vector<std::shared_ptr<real_data<T>>> &operands() const {
+                return _operands;
+            }
+
+            /// adds an operand to a SUM or PRODUCT
+            void push_operand(std::shared_ptr<real_data<T>> operand) {
+                _operands.push_back(std::move(operand));
+            }
+
+            /**
+             * @brief Moves the operands out of the operation and into operands, leaving the
+             * operation empty. Used to tear down operation trees without recursion.
+             */
+            void release_operands(std::vector<std::shared_ptr<real_data<T>>> &operands) {
+                if (is_n_ary(_operation)) {
+                    std::move(_operands.begin(), _operands.end(), std::back_inserter(operands));
+                    _operands.clear();
+                } else {
+                    operands.push_back(std::move(_lhs));
+                    if (_rhs != nullptr) {
+                        operands.push_back(std::move(_rhs));
+                    }
+                }
+            }
         };
     }
 }
@@ -0,0 +1,278 @@
+#ifndef BOOST_REAL_THREAD_POOL_HPP
+#define BOOST_REAL_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A fixed set of worker threads, each with its own deque of tasks.
+         *
+         * A worker pushes and pops the tasks it creates at the back of its own deque, so nested
+         * tasks run depth first on the thread that created them, and an idle worker steals from
+         * the front of the other deques, which holds the oldest and usually largest tasks. Tasks
+         * submitted from outside the pool are spread over the deques.
+         *
+         * Tasks are meant to be waited for with a task_group, whose waiting thread runs pending
+         * tasks instead of blocking, so tasks may themselves create and wait for tasks.
+         */
+        class work_stealing_pool {
+            struct task_queue {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            std::vector<std::unique_ptr<task_queue>> _queues;
+            std::vector<std::thread> _workers;
+
+            std::mutex _sleep_mutex;
+            std::condition_variable _wake_up;
+            std::atomic<size_t> _queued{0};
+            std::atomic<size_t> _next_queue{0};
+            bool _stopping = false;
+
+            /// the pool and queue of the current thread, if it is a worker
+            inline static thread_local work_stealing_pool *_current_pool = nullptr;
+            inline static thread_local size_t _current_queue = 0;
+
+            bool pop(size_t queue, std::function<void()> &task, bool back) {
+                std::lock_guard<std::mutex> lock(_queues[queue]->mutex);
+                auto &tasks = _queues[queue]->tasks;
+                if (tasks.empty()) {
+                    return false;
+                }
+                if (back) {
+                    task = std::move(tasks.back());
+                    tasks.pop_back();
+                } else {
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                --_queued;
+                return true;
+            }
+
+            void work(size_t queue) {
+                _current_pool = this;
+                _current_queue = queue;
+
+                while (true) {
+                    if (run_pending_task()) {
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(_sleep_mutex);
+                    _wake_up.wait(lock, [this] { return _stopping || _queued > 0; });
+                    if (_stopping && _queued == 0) {
+                        return;
+                    }
+                }
+            }
+
+            public:
+            /**
+             * @brief Starts the workers.
+             *
+             * @param threads - the number of worker threads, the hardware concurrency by default.
+             */
+            explicit work_stealing_pool(size_t threads = std::thread::hardware_concurrency()) {
+                threads = std::max<size_t>(threads, 1);
+                for (size_t i = 0; i < threads; ++i) {
+                    _queues.push_back(std::make_unique<task_queue>());
+                }
+                for (size_t i = 0; i < threads; ++i) {
+                    _workers.emplace_back([this, i] { work(i); });
+                }
+            }
+
+            work_stealing_pool(const work_stealing_pool &) = delete;
+            work_stealing_pool &operator=(const work_stealing_pool &) = delete;
+
+            /// runs the tasks still queued and joins the workers
+            ~work_stealing_pool() {
+                {
+                    std::lock_guard<std::mutex> lock(_sleep_mutex);
+                    _stopping = true;
+                }
+                _wake_up.notify_all();
+                for (std::thread &worker : _workers) {
+                    worker.join();
+                }
+            }
+
+            size_t size() const {
+                return _workers.size();
+            }
+
+            /// queues task, on the deque of the current thread if it is a worker of this pool
+            void submit(std::function<void()> task) {
+                size_t queue = (_current_pool == this) ? _current_queue : _next_queue++ % _queues.size();
+                {
+                    std::lock_guard<std::mutex> lock(_queues[queue]->mutex);
+                    _queues[queue]->tasks.push_back(std::move(task));
+                    ++_queued;
+                }
+                {
+                    // taking the lock orders the notification after a worker checked _queued
+                    std::lock_guard<std::mutex> lock(_sleep_mutex);
+                }
+                _wake_up.notify_one();
+            }
+
+            /**
+             * @brief Runs one queued task: the newest of the current worker, or else the oldest
+             * of another deque.
+             *
+             * @return false if there was no task to run.
+             */
+            bool run_pending_task() {
+                std::function<void()> task;
+                size_t first = (_current_pool == this) ? _current_queue : 0;
+                bool found = (_current_pool == this) && pop(first, task, true);
+
+                for (size_t i = 1; !found && i <= _queues.size(); ++i) {
+                    found = pop((first + i) % _queues.size(), task, false);
+                }
+
+                if (found) {
+                    task();
+                }
+                return found;
+            }
+        };
+
+        /**
+         * @brief A set of tasks run on a work_stealing_pool that can be waited for. The first
+         * exception thrown by a task is rethrown by wait().
+         */
+        class task_group {
+            work_stealing_pool &_pool;
+            std::atomic<size_t> _unfinished{0};
+            std::mutex _error_mutex;
+            std::exception_ptr _error;
+
+            public:
+            explicit task_group(work_stealing_pool &pool) : _pool(pool) {}
+
+            task_group(const task_group &) = delete;
+            task_group &operator=(const task_group &) = delete;
+
+            ~task_group() {
+                // the tasks refer to this group, it cannot go away before they finished
+                while (_unfinished > 0) {
+                    if (!_pool.run_pending_task()) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void run(std::function<void()> task) {
+                ++_unfinished;
+                _pool.submit([this, task = std::move(task)] {
+                    try {
+                        task();
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(_error_mutex);
+                        if (!_error) {
+                            _error = std::current_exception();
+                        }
+                    }
+                    --_unfinished;
+                });
+            }
+
+            /// runs queued tasks until all the tasks of the group finished
+            void wait() {
+                while (_unfinished > 0) {
+                    if (!_pool.run_pending_task()) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(_error_mutex);
+                if (_error) {
+                    std::exception_ptr error = std::exchange(_error, nullptr);
+                    std::rethrow_exception(error);
+                }
+            }
+        };
+
+        namespace detail {
+            /**
+             * @brief Computes the pair (lower(), upper()), with both calls running in parallel when
+             * a pool is given.
+             *
+             * The caller may hold the locks of the number whose bounds these are, so unlike a
+             * task_group it never runs the pending tasks of other evaluations while it waits,
+             * which could need those locks: it computes upper() itself if no worker started it.
+             */
+            template <typename L, typename U>
+            auto parallel_bounds(work_stealing_pool *pool, L lower, U upper) -> std::pair<decltype(lower()), decltype(upper())> {
+                if (pool == nullptr) {
+                    auto lower_bound = lower();
+                    return {std::move(lower_bound), upper()};
+                }
+
+                struct upper_task {
+                    std::atomic<bool> started{false};
+                    std::atomic<bool> finished{false};
+                    decltype(upper()) bound;
+                    std::exception_ptr error;
+                };
+
+                // the task may run after this call returned, it only uses upper if it started first
+                auto task = std::make_shared<upper_task>();
+                pool->submit([task, &upper] {
+                    if (task->started.exchange(true)) {
+                        return;
+                    }
+                    try {
+                        task->bound = upper();
+                    } catch (...) {
+                        task->error = std::current_exception();
+                    }
+                    task->finished = true;
+                });
+
+                decltype(lower()) lower_bound;
+                std::exception_ptr lower_error;
+                try {
+                    lower_bound = lower();
+                } catch (...) {
+                    lower_error = std::current_exception();
+                }
+
+                if (!task->started.exchange(true)) {
+                    if (lower_error) {
+                        std::rethrow_exception(lower_error);
+                    }
+                    return {std::move(lower_bound), upper()};
+                }
+
+                while (!task->finished) {
+                    std::this_thread::yield();
+                }
+                if (lower_error) {
+                    std::rethrow_exception(lower_error);
+                }
+                if (task->error) {
+                    std::rethrow_exception(task->error);
+                }
+                return {std::move(lower_bound), std::move(task->bound)};
+            }
+        }
+    }
+}
+
+#endif //BOOST_REAL_THREAD_POOL_HPP
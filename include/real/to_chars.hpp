@@ -0,0 +1,416 @@
+#ifndef BOOST_REAL_TO_CHARS_HPP
+#define BOOST_REAL_TO_CHARS_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+#include <vector>
+
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+#include <real/limb_literal.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Direction in which boost::real::to_chars rounds the last printed digit.
+         *
+         * DOWN and UP round towards -infinity and +infinity, so formatting the bounds of an interval
+         * with DOWN and UP respectively always prints an interval that contains it. NEAREST rounds
+         * half away from zero.
+         */
+        enum class ROUNDING {DOWN, UP, TOWARD_ZERO, NEAREST};
+
+        namespace detail {
+
+            /**
+             * @brief Scratch limbs for the base conversion. Numbers of up to N limbs, which covers the
+             * usual precisions, are converted without touching the heap.
+             */
+            template <typename T, std::size_t N = 32>
+            class limb_scratch {
+                std::array<T, N> _inline_limbs{};
+                std::vector<T> _heap_limbs;
+                T* _limbs;
+
+            public:
+                explicit limb_scratch(std::size_t size) : _limbs(_inline_limbs.data()) {
+                    if (size > N) {
+                        _heap_limbs.resize(size);
+                        _limbs = _heap_limbs.data();
+                    }
+                }
+
+                limb_scratch(const limb_scratch&) = delete;
+                limb_scratch& operator=(const limb_scratch&) = delete;
+
+                T& operator[](std::size_t i) {
+                    return _limbs[i];
+                }
+            };
+
+            /// the largest power of ten that is lower than the limb base
+            template <typename T>
+            constexpr T decimal_chunk() {
+                T chunk = 1;
+                for (std::size_t i = 0; i < decimal_digits_per_limb<T>(); ++i) {
+                    chunk *= 10;
+                }
+                return chunk;
+            }
+
+            /**
+             * @brief Calls emit with the decimal digits of the integer part of |number|, the least
+             * significant first. Emits nothing if the integer part is zero.
+             */
+            template <typename T, typename F>
+            void for_each_integer_digit(const exact_number<T>& number, F&& emit) {
+                constexpr T base = limb_base<T>();
+                constexpr T chunk = decimal_chunk<T>();
+                constexpr std::size_t chunk_digits = decimal_digits_per_limb<T>();
+
+                std::size_t size = number.exponent > 0 ? number.exponent : 0;
+                limb_scratch<T> limbs(size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    limbs[i] = i < number.digits.size() ? number.digits[i] : 0;
+                }
+
+                std::size_t begin = 0;
+                while (begin < size && limbs[begin] == 0) {
+                    ++begin;
+                }
+
+                // each pass divides the integer by chunk and emits the remainder
+                while (begin < size) {
+                    T remainder = 0;
+                    for (std::size_t i = begin; i < size; ++i) {
+                        // (remainder * base + limb) / chunk, without overflowing T
+                        T low = exact_number<T>::mul_mod(remainder, base, chunk) + limbs[i];
+                        limbs[i] = exact_number<T>::mult_div(remainder, base, chunk) + low / chunk;
+                        remainder = low % chunk;
+                    }
+
+                    while (begin < size && limbs[begin] == 0) {
+                        ++begin;
+                    }
+
+                    bool most_significant = (begin == size);
+                    for (std::size_t i = 0; i < chunk_digits && !(most_significant && remainder == 0); ++i) {
+                        emit((char) ('0' + remainder % 10));
+                        remainder /= 10;
+                    }
+                }
+            }
+
+            /**
+             * @brief Produces the decimal digits of the fractional part of |number| one by one. The
+             * expansion of a limb fraction may not terminate, so the stream is unbounded; exhausted()
+             * tells whether every remaining digit is zero.
+             */
+            template <typename T>
+            class fraction_digit_stream {
+                static constexpr std::size_t _chunk_digits = decimal_digits_per_limb<T>();
+
+                limb_scratch<T> _limbs;
+                std::size_t _size;
+                std::array<char, _chunk_digits> _chunk;
+                std::size_t _position = _chunk_digits;
+
+                static std::size_t fraction_size(const exact_number<T>& number) {
+                    if (number.exponent < 0) {
+                        return number.digits.size() - number.exponent;
+                    }
+                    return number.digits.size() > (std::size_t) number.exponent ? number.digits.size() - number.exponent : 0;
+                }
+
+                /// fraction = fraction * chunk, keeping the integer part of the product as the next chunk
+                void next_chunk() {
+                    constexpr T base = limb_base<T>();
+                    constexpr T chunk = decimal_chunk<T>();
+
+                    T carry = 0;
+                    for (std::size_t i = _size; i > 0; --i) {
+                        T low = exact_number<T>::mul_mod(_limbs[i - 1], chunk, base) + carry;
+                        T high = exact_number<T>::mult_div(_limbs[i - 1], chunk, base);
+                        if (low >= base) {
+                            low -= base;
+                            ++high;
+                        }
+                        _limbs[i - 1] = low;
+                        carry = high;
+                    }
+
+                    while (_size > 0 && _limbs[_size - 1] == 0) {
+                        --_size;
+                    }
+
+                    for (std::size_t i = _chunk_digits; i > 0; --i) {
+                        _chunk[i - 1] = (char) ('0' + carry % 10);
+                        carry /= 10;
+                    }
+                    _position = 0;
+                }
+
+            public:
+                explicit fraction_digit_stream(const exact_number<T>& number)
+                        : _limbs(fraction_size(number)), _size(fraction_size(number)) {
+                    std::size_t leading_zeros = number.exponent < 0 ? -number.exponent : 0;
+                    std::size_t first_digit = number.exponent > 0 ? number.exponent : 0;
+                    for (std::size_t i = 0; i < _size; ++i) {
+                        _limbs[i] = i < leading_zeros ? 0 : number.digits[first_digit + i - leading_zeros];
+                    }
+                    while (_size > 0 && _limbs[_size - 1] == 0) {
+                        --_size;
+                    }
+                }
+
+                char next() {
+                    if (_position == _chunk_digits) {
+                        if (_size == 0) {
+                            return '0';
+                        }
+                        next_chunk();
+                    }
+                    return _chunk[_position++];
+                }
+
+                bool exhausted() const {
+                    return _size == 0 && std::all_of(_chunk.begin() + _position, _chunk.end(), [](char c) { return c == '0'; });
+                }
+            };
+
+            inline std::to_chars_result value_too_large(char* last) {
+                return {last, std::errc::value_too_large};
+            }
+        }
+
+        /**
+         * @brief Formats number into [first, last) without allocating (up to the precisions the
+         * inline scratch of detail::limb_scratch covers) and without building a std::string.
+         *
+         * @param format - std::chars_format::fixed prints digits digits after the decimal point,
+         * std::chars_format::scientific prints digits digits after the point of the mantissa,
+         * followed by the decimal exponent as e+XX or e-XX.
+         * @param digits - the number of digits after the decimal point.
+         * @param rounding - how the last printed digit is rounded.
+         * @return a std::to_chars_result with ptr one past the last written character, or
+         * {last, std::errc::value_too_large} if the buffer is too small, in which case the contents
+         * of [first, last) are unspecified.
+         */
+        template <typename T>
+        std::to_chars_result to_chars(char* first, char* last, const exact_number<T>& number,
+                                      std::chars_format format, int digits, ROUNDING rounding = ROUNDING::NEAREST) {
+            if (format != std::chars_format::fixed && format != std::chars_format::scientific) {
+                return {last, std::errc::invalid_argument};
+            }
+
+            std::size_t precision = digits < 0 ? 0 : digits;
+            bool zero = std::all_of(number.digits.begin(), number.digits.end(), [](T d) { return d == 0; });
+            bool positive = number.positive || zero;
+
+            char* out = first;
+            if (!positive) {
+                if (out == last) {
+                    return detail::value_too_large(last);
+                }
+                *out++ = '-';
+            }
+
+            char* mantissa = out;
+            char round_digit = '0';
+            bool sticky = false;
+            std::size_t integer_length = 0;
+            long decimal_exponent = 0;
+            detail::fraction_digit_stream<T> fraction(number);
+
+            if (format == std::chars_format::fixed) {
+                bool overflow = false;
+                detail::for_each_integer_digit(number, [&](char c) {
+                    if (out == last) {
+                        overflow = true;
+                    } else {
+                        *out++ = c;
+                    }
+                });
+                if (overflow) {
+                    return detail::value_too_large(last);
+                }
+                std::reverse(mantissa, out);
+
+                if (out == mantissa) {
+                    if (out == last) {
+                        return detail::value_too_large(last);
+                    }
+                    *out++ = '0';
+                }
+                integer_length = out - mantissa;
+
+                if ((std::size_t) (last - out) < precision) {
+                    return detail::value_too_large(last);
+                }
+                for (std::size_t i = 0; i < precision; ++i) {
+                    *out++ = fraction.next();
+                }
+                round_digit = fraction.next();
+                sticky = !fraction.exhausted();
+            } else {
+                // the mantissa digits plus the rounding digit. The integer digits come least
+                // significant first, so only the last window of them is kept, in a ring buffer.
+                std::size_t window = precision + 2;
+                if ((std::size_t) (last - out) < window) {
+                    return detail::value_too_large(last);
+                }
+
+                std::size_t count = 0;
+                detail::for_each_integer_digit(number, [&](char c) {
+                    char& slot = mantissa[count % window];
+                    if (count >= window) {
+                        sticky = sticky || slot != '0';
+                    }
+                    slot = c;
+                    ++count;
+                });
+
+                std::size_t kept = std::min(count, window);
+                if (count > 0) {
+                    if (count > window) {
+                        std::rotate(mantissa, mantissa + count % window, mantissa + window);
+                    }
+                    std::reverse(mantissa, mantissa + kept);
+                    decimal_exponent = count - 1;
+                } else if (!zero) {
+                    char c = fraction.next();
+                    decimal_exponent = -1;
+                    while (c == '0') {
+                        c = fraction.next();
+                        --decimal_exponent;
+                    }
+                    mantissa[0] = c;
+                    kept = 1;
+                }
+
+                while (kept < window) {
+                    mantissa[kept++] = fraction.next();
+                }
+                round_digit = mantissa[window - 1];
+                sticky = sticky || !fraction.exhausted();
+                out = mantissa + precision + 1;
+            }
+
+            bool inexact = round_digit != '0' || sticky;
+            bool away_from_zero = false;
+            switch (rounding) {
+                case ROUNDING::DOWN:
+                    away_from_zero = !positive && inexact;
+                    break;
+                case ROUNDING::UP:
+                    away_from_zero = positive && inexact;
+                    break;
+                case ROUNDING::TOWARD_ZERO:
+                    break;
+                case ROUNDING::NEAREST:
+                    away_from_zero = round_digit >= '5';
+                    break;
+            }
+
+            if (away_from_zero) {
+                char* p = out;
+                while (p != mantissa && *(p - 1) == '9') {
+                    *--p = '0';
+                }
+                if (p != mantissa) {
+                    ++*(p - 1);
+                } else if (format == std::chars_format::fixed) {
+                    // 99.9 -> 100.0, one more integer digit
+                    if (out == last) {
+                        return detail::value_too_large(last);
+                    }
+                    std::copy_backward(mantissa, out, out + 1);
+                    *mantissa = '1';
+                    ++out;
+                    ++integer_length;
+                } else {
+                    // 9.99e+01 -> 1.00e+02
+                    *mantissa = '1';
+                    ++decimal_exponent;
+                }
+            }
+
+            std::size_t point = (format == std::chars_format::fixed) ? integer_length : 1;
+            if (precision > 0) {
+                if (out == last) {
+                    return detail::value_too_large(last);
+                }
+                std::copy_backward(mantissa + point, out, out + 1);
+                mantissa[point] = '.';
+                ++out;
+            }
+
+            if (format == std::chars_format::scientific) {
+                std::array<char, 24> exponent_digits;
+                unsigned long magnitude = decimal_exponent < 0 ? -decimal_exponent : decimal_exponent;
+                auto [end, ec] = std::to_chars(exponent_digits.data(), exponent_digits.data() + exponent_digits.size(), magnitude);
+                std::size_t length = end - exponent_digits.data();
+
+                if ((std::size_t) (last - out) < 2 + std::max<std::size_t>(length, 2)) {
+                    return detail::value_too_large(last);
+                }
+                *out++ = 'e';
+                *out++ = decimal_exponent < 0 ? '-' : '+';
+                if (length < 2) {
+                    *out++ = '0';
+                }
+                out = std::copy(exponent_digits.data(), end, out);
+            }
+
+            return {out, std::errc()};
+        }
+
+        /**
+         * @brief Formats an interval into [first, last) as [lower, upper], with the lower bound
+         * rounded down and the upper bound rounded up so the printed interval contains the original
+         * one. An interval that represents a single number is printed as that number, rounded to
+         * nearest.
+         *
+         * @see boost::real::to_chars(char*, char*, const exact_number<T>&, std::chars_format, int, ROUNDING)
+         */
+        template <typename T>
+        std::to_chars_result to_chars(char* first, char* last, const interval<T>& bounds, std::chars_format format, int digits) {
+            if (bounds.is_a_number()) {
+                return to_chars(first, last, bounds.lower_bound, format, digits, ROUNDING::NEAREST);
+            }
+
+            if (first == last) {
+                return detail::value_too_large(last);
+            }
+            *first++ = '[';
+
+            auto result = to_chars(first, last, bounds.lower_bound, format, digits, ROUNDING::DOWN);
+            if (result.ec != std::errc()) {
+                return result;
+            }
+
+            if (last - result.ptr < 2) {
+                return detail::value_too_large(last);
+            }
+            *result.ptr++ = ',';
+            *result.ptr++ = ' ';
+
+            result = to_chars(result.ptr, last, bounds.upper_bound, format, digits, ROUNDING::UP);
+            if (result.ec != std::errc()) {
+                return result;
+            }
+
+            if (result.ptr == last) {
+                return detail::value_too_large(last);
+            }
+            *result.ptr++ = ']';
+            return result;
+        }
+    }
+}
+
+#endif //BOOST_REAL_TO_CHARS_HPP
@@ -7,7 +7,7 @@
 
 int BASE = (std::numeric_limits<int>::max() /4)*2;
 
-template<> std::optional<size_t> boost::real::const_precision_iterator<int>::global_maximum_precision = 10;
+template<> std::atomic<size_t> boost::real::const_precision_iterator<int>::global_maximum_precision{10};
 
 namespace Catch {
     template<>
@@ -27,6 +27,20 @@ namespace Catch {
     };
 }
 
+// operations between explicit numbers build operation nodes, instead of being folded, while it exists
+template <typename T = int>
+struct without_folding {
+    size_t previous = boost::real::real<T>::constant_folding_limit;
+
+    without_folding() {
+        boost::real::real<T>::constant_folding_limit = 0;
+    }
+
+    ~without_folding() {
+        boost::real::real<T>::constant_folding_limit = previous;
+    }
+};
+
 int one_and_max(unsigned int n) { /* 199999..... (for base 10)*/
     if (n == 0) {
         return 1;
@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <real/limb_literal.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    // the conversion must be usable in constant expressions
+    constexpr auto compile_time_literal = boost::real::detail::make_limb_literal<int>("1073741823");
+    static_assert(compile_time_literal.is_integral(), "1073741823 is an integer");
+    static_assert(compile_time_literal.numerator_size == 2, "1073741823 = 1 * base + 1");
+    static_assert(compile_time_literal.numerator_digits[0] == 1 && compile_time_literal.numerator_digits[1] == 1,
+                  "1073741823 = 1 * base + 1");
+
+    constexpr auto compile_time_fraction = boost::real::detail::make_limb_literal<int>("-1.5e-1");
+    static_assert(!compile_time_fraction.is_integral() && !compile_time_fraction.positive, "-15 / 100");
+}
+
+TEMPLATE_TEST_CASE("Limb literal conversion", "[template]", int, long, long long) {
+    using boost::real::detail::make_limb_literal;
+    using real_explicit = boost::real::real_explicit<TestType>;
+
+    SECTION("Integers have the same limbs as real_explicit") {
+        std::vector<std::string> numbers = {"0", "7", "-123", "1000000000000", "1234567890123456789012345678901234567890"};
+        constexpr auto a = make_limb_literal<TestType>("0");
+        constexpr auto b = make_limb_literal<TestType>("7");
+        constexpr auto c = make_limb_literal<TestType>("-123");
+        constexpr auto d = make_limb_literal<TestType>("1000000000000");
+        constexpr auto e = make_limb_literal<TestType>("1234567890123456789012345678901234567890");
+
+        CHECK(a.numerator() == real_explicit(numbers[0]).get_exact_number());
+        CHECK(b.numerator() == real_explicit(numbers[1]).get_exact_number());
+        CHECK(c.numerator() == real_explicit(numbers[2]).get_exact_number());
+        CHECK(d.numerator() == real_explicit(numbers[3]).get_exact_number());
+        CHECK(e.numerator() == real_explicit(numbers[4]).get_exact_number());
+        CHECK(d.numerator().exponent == real_explicit(numbers[3]).exponent());
+    }
+
+    SECTION("Decimal exponents and zeros are normalized") {
+        constexpr auto a = make_limb_literal<TestType>("12300.00");
+        constexpr auto b = make_limb_literal<TestType>("1230000.00e-2");
+        constexpr auto c = make_limb_literal<TestType>("0.0012e4");
+
+        CHECK(a.is_integral());
+        CHECK(b.is_integral());
+        CHECK(c.is_integral());
+        CHECK(a.numerator() == real_explicit("12300").get_exact_number());
+        CHECK(b.numerator() == real_explicit("12300").get_exact_number());
+        CHECK(c.numerator() == real_explicit("12").get_exact_number());
+    }
+
+    SECTION("Fractions are stored as numerator / power of ten") {
+        constexpr auto a = make_limb_literal<TestType>("1234.5");
+        constexpr auto b = make_limb_literal<TestType>("6.62607015e-34");
+
+        CHECK_FALSE(a.is_integral());
+        CHECK(a.numerator() == real_explicit("12345").get_exact_number());
+        CHECK(a.denominator() == real_explicit("10").get_exact_number());
+        CHECK(b.numerator() == real_explicit("662607015").get_exact_number());
+        CHECK(b.denominator() == real_explicit("1e42").get_exact_number());
+    }
+
+    SECTION("Malformed literals throw at runtime") {
+        CHECK_THROWS_AS((boost::real::detail::parse_limb_literal<TestType, 4>("1.2.3", 5)), boost::real::invalid_string_number_exception);
+        CHECK_THROWS_AS((boost::real::detail::parse_limb_literal<TestType, 4>("12e", 3)), boost::real::invalid_string_number_exception);
+        CHECK_THROWS_AS((boost::real::detail::parse_limb_literal<TestType, 1>("1e100", 5)), boost::real::limb_literal_overflow_exception);
+    }
+}
+
+TEST_CASE("Numeric _r literals") {
+    using real = boost::real::real<int>;
+
+    auto interval_of = [](const real& number) {
+        return number.get_real_itr().cend().get_interval();
+    };
+
+    SECTION("Literals build the same number as the string constructor") {
+        CHECK(interval_of(1.0072764_r) == interval_of(real("1.0072764")));
+        CHECK(interval_of(12345678901234567890_r) == interval_of(real("12345678901234567890")));
+        CHECK(interval_of(6.62607015e-34_r) == interval_of(real("6.62607015e-34")));
+        CHECK(interval_of(1'000.5_r) == interval_of(real("1000.5")));
+        CHECK(12345678901234567890_r == real("12345678901234567890"));
+    }
+
+    SECTION("Hexadecimal, octal and binary integers") {
+        CHECK(interval_of(0x10_r) == interval_of(real("16")));
+        CHECK(interval_of(0XfF_r) == interval_of(real("255")));
+        CHECK(interval_of(0b101_r) == interval_of(real("5")));
+        CHECK(interval_of(017_r) == interval_of(real("15")));
+        CHECK(interval_of(0x0_r) == interval_of(real("0")));
+        CHECK(interval_of(0xFFFF'FFFF'FFFF'FFFF'FFFF_r) == interval_of(real("1208925819614629174706175")));
+        CHECK_THROWS_AS((boost::real::detail::parse_integer_limb_literal<int, 4>("0b102", 5, 2)), boost::real::invalid_string_number_exception);
+    }
+
+    SECTION("Literals keep all their digits") {
+        CHECK_FALSE(interval_of(1.0072764_r) == interval_of(real("1.007276")));
+    }
+}
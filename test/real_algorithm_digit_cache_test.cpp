@@ -0,0 +1,132 @@
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/irrational_helpers.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+
+    unsigned int digit_calls = 0;
+    unsigned int block_calls = 0;
+    unsigned int produced_digits = 0;
+
+    int counted_digit(unsigned int n) {
+        ++digit_calls;
+        return (int) (n % 9) + 1;
+    }
+
+    void counted_block(unsigned int start, unsigned int count, int *out) {
+        ++block_calls;
+        produced_digits += count;
+        for (unsigned int i = 0; i < count; ++i) {
+            out[i] = (int) ((start + i) % 9) + 1;
+        }
+    }
+
+    const boost::real::real_algorithm<int>& algorithm_of(real &number) {
+        return std::get<boost::real::real_algorithm<int>>(number.get_real_number());
+    }
+}
+
+TEST_CASE("Digits of algorithmic numbers are produced once") {
+    digit_calls = 0;
+    real number(counted_digit, 1);
+
+    auto it = number.get_real_itr().cbegin();
+    it.iterate_n_times(8);
+    CHECK(digit_calls == 9);
+
+    // other iterators, copies of the number and comparisons reuse the digits
+    auto other = number.get_real_itr().cbegin();
+    other.iterate_n_times(8);
+    real copy = number;
+    CHECK(copy[5] == 6);
+    CHECK(number < real("1.3"));
+    CHECK(digit_calls == algorithm_of(number).cached_digits());
+    CHECK(algorithm_of(copy).cached_digits() == algorithm_of(number).cached_digits());
+    CHECK(other.get_interval() == it.get_interval());
+
+    std::vector<int> digits;
+    algorithm_of(number).get_digits(3, 4, std::back_inserter(digits));
+    CHECK(digits == std::vector<int> {4, 5, 6, 7});
+}
+
+TEST_CASE("Digits of algorithmic numbers can be produced in blocks") {
+    block_calls = 0;
+    produced_digits = 0;
+    real number(counted_block, 1);
+    real same(counted_digit, 1);
+
+    // the first digit was produced when the number was built
+    std::vector<int> digits;
+    algorithm_of(number).get_digits(0, 20, std::back_inserter(digits));
+    CHECK(block_calls == 2);
+    for (unsigned int i = 0; i < 20; ++i) {
+        CHECK(digits[i] == same[i]);
+    }
+
+    // digits requested one by one are produced in growing blocks
+    for (unsigned int i = 0; i < 1000; ++i) {
+        CHECK(number[i] == same[i]);
+    }
+    CHECK(block_calls <= 9);
+    CHECK(produced_digits == algorithm_of(number).cached_digits());
+
+    auto it = number.get_real_itr().cbegin();
+    auto same_it = same.get_real_itr().cbegin();
+    it.iterate_n_times(6);
+    same_it.iterate_n_times(6);
+    CHECK(it.get_interval() == same_it.get_interval());
+
+    real negative(counted_block, 0, false);
+    CHECK(negative < real("0"));
+    CHECK(real("-0.001") < negative);
+}
+
+TEST_CASE("Digits of algorithmic numbers from stateful generators") {
+    // a generator that only works when asked for its digits in order
+    struct stream {
+        std::shared_ptr<unsigned int> next = std::make_shared<unsigned int>(0);
+
+        int operator()(unsigned int n) {
+            REQUIRE(n == *next);
+            ++*next;
+            return (int) (n % 9) + 1;
+        }
+    };
+
+    stream generator;
+    real number(generator, 1);
+    real same(counted_digit, 1);
+    real copy = number;
+
+    auto it = number.get_real_itr().cbegin();
+    auto copy_it = copy.get_real_itr().cbegin();
+    auto same_it = same.get_real_itr().cbegin();
+    it.iterate_n_times(5);
+    copy_it.iterate_n_times(9);
+    same_it.iterate_n_times(9);
+    it.iterate_n_times(4);
+    CHECK(it.get_interval() == same_it.get_interval());
+    CHECK(copy_it.get_interval() == same_it.get_interval());
+    CHECK(*generator.next == 10);
+
+    // a lambda keeping the partial sums of a series between calls
+    unsigned int previous = 0;
+    real with_state([previous](unsigned int n) mutable -> int {
+        previous += n;
+        return (int) (previous % 7);
+    }, 0);
+    for (unsigned int n = 0; n < 10; ++n) {
+        CHECK(with_state[n] == (int) ((n * (n + 1) / 2) % 7));
+    }
+
+    boost::real::irrational::champernowne_binary_digits champernowne;
+    for (unsigned int n = 0; n < 300; ++n) {
+        CHECK(champernowne(n) == boost::real::irrational::champernowne_binary_get_nth_digit(n));
+    }
+    CHECK(champernowne(3) == boost::real::irrational::champernowne_binary_get_nth_digit(3));
+}
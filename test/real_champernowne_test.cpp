@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+#include <string>
+#include <vector>
+
+#include <real/irrationals.hpp>
+
+namespace {
+    // the first digits of the number, by concatenating the binary representations of 1, 2, ...
+    std::string concatenated_integers(unsigned int digits) {
+        std::string number;
+        for (unsigned long long integer = 1; number.size() < digits; ++integer) {
+            std::string binary;
+            for (unsigned long long rest = integer; rest != 0; rest /= 2) {
+                binary.insert(binary.begin(), (char) ('0' + rest % 2));
+            }
+            number += binary;
+        }
+        number.resize(digits);
+        return number;
+    }
+
+    // the index of the first digit of the integers with length binary digits
+    unsigned long long first_of_length(int length) {
+        unsigned long long index = 0;
+        for (int k = 1; k < length; ++k) {
+            index += (unsigned long long) k << (k - 1);
+        }
+        return index;
+    }
+}
+
+TEST_CASE("Champernowne digits are located without counting up to them") {
+    using namespace boost::real::irrational;
+    const std::string expected = concatenated_integers(5000);
+
+    for (unsigned int n = 0; n < expected.size(); ++n) {
+        CHECK(champernowne_binary_get_nth_digit(n) == expected[n] - '0');
+    }
+
+    // far digits: every block of integers of the same length starts with 1, 0, ..., 0
+    for (int length = 2; length <= 28; ++length) {
+        unsigned long long integer;
+        int integer_length;
+        unsigned long long first = first_of_length(length);
+
+        CHECK(champernowne_binary_locate(first, integer, integer_length) == 0);
+        CHECK(integer == 1ull << (length - 1));
+        CHECK(integer_length == length);
+        CHECK(champernowne_binary_get_nth_digit((unsigned int) first) == 1);
+        CHECK(champernowne_binary_get_nth_digit((unsigned int) first + 1) == 0);
+
+        // the last digit before the block is the last 1 of 2^(length - 1) - 1
+        CHECK(champernowne_binary_locate(first - 1, integer, integer_length) == length - 2);
+        CHECK(integer == (1ull << (length - 1)) - 1);
+        CHECK(champernowne_binary_get_nth_digit((unsigned int) first - 1) == 1);
+    }
+}
+
+TEST_CASE("Champernowne digits in blocks") {
+    using namespace boost::real::irrational;
+    const std::string expected = concatenated_integers(3000);
+
+    std::vector<int> block(1000);
+    for (unsigned int start : {0u, 1u, 2u, 5u, 17u, 321u, 1999u}) {
+        champernowne_binary_digits_block<int>(start, 1000, block.data());
+        for (unsigned int i = 0; i < 1000; ++i) {
+            CHECK(block[i] == expected[start + i] - '0');
+        }
+    }
+
+    // a block far away agrees with the digits located one by one
+    champernowne_binary_digits_block<int>(3000000000u, 1000, block.data());
+    for (unsigned int i = 0; i < 1000; ++i) {
+        CHECK(block[i] == champernowne_binary_get_nth_digit(3000000000u + i));
+    }
+
+    // the stream jumps to any digit asked
+    champernowne_binary_digits stream;
+    for (unsigned int n : {10u, 11u, 12u, 4u, 2500u, 2501u, 0u}) {
+        CHECK(stream(n) == expected[n] - '0');
+    }
+
+    for (unsigned int n = 0; n < 200; ++n) {
+        CHECK(CHAMPERNOWNE_BINARY[n] == expected[n] - '0');
+    }
+}
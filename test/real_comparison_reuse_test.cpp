@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+
+    int counted_calls = 0;
+
+    int counted_ones(unsigned int) {
+        ++counted_calls;
+        return 1;
+    }
+
+    int ones_then_two(unsigned int n) { /* 1111...12 */
+        return n < 7 ? 1 : 2;
+    }
+
+    int ones_then_three(unsigned int n) { /* 1111...13 */
+        return n < 7 ? 1 : 3;
+    }
+}
+
+TEST_CASE("Comparisons continue from the precision previous comparisons reached") {
+    real a(counted_ones, 1);
+    real b(ones_then_two, 1);
+    real c(ones_then_three, 1);
+
+    CHECK(a < b);
+    int calls = counted_calls;
+
+    // a is already precise enough to be told apart from c
+    CHECK(a < c);
+    CHECK(c > a);
+    CHECK_FALSE(a == c);
+    CHECK(counted_calls == calls);
+
+    // comparing does not change the intervals the number shows elsewhere
+    CHECK(a.get_real_itr().get_interval() == a.get_real_itr().cbegin().get_interval());
+}
+
+TEST_CASE("Comparisons of operations keep their refinement") {
+    real a = real(counted_ones, 1) * real("3");
+    real b = real(ones_then_two, 1) * real("3");
+
+    CHECK(a < b);
+    int calls = counted_calls;
+    CHECK(a < b);
+    CHECK_FALSE(b < a);
+    CHECK(counted_calls == calls);
+
+    CHECK_THROWS_AS(a == a, boost::real::precision_exception);
+}
+
+TEST_CASE("Sorting with persistent comparisons") {
+    real x(ones, 0);
+    std::vector<real> numbers = {x * real("3"), x + real("1"), x, x * x, x - real("1"), real(ones_then_two, 0)};
+    std::sort(numbers.begin(), numbers.end());
+
+    for (size_t i = 1; i < numbers.size(); ++i) {
+        CHECK(numbers[i - 1] < numbers[i]);
+    }
+}
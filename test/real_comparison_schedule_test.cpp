@@ -0,0 +1,58 @@
+#include <catch2/catch.hpp>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using iterator = boost::real::const_precision_iterator<int>;
+    using boost::real::PRECISION_SCHEDULE;
+
+    std::vector<boost::real::precision_t> first_precisions(PRECISION_SCHEDULE schedule, int n) {
+        boost::real::precision_schedule precisions(schedule);
+        std::vector<boost::real::precision_t> result;
+        for (int i = 0; i < n; ++i) {
+            result.push_back(precisions.next());
+        }
+        return result;
+    }
+
+    int ones_then_two(unsigned int n) { /* 1111...12 */
+        return n < 7 ? 1 : 2;
+    }
+}
+
+TEST_CASE("Precision schedules") {
+    using precisions = std::vector<boost::real::precision_t>;
+
+    CHECK(first_precisions(PRECISION_SCHEDULE::LINEAR, 5) == precisions {2, 3, 4, 5, 6});
+    CHECK(first_precisions(PRECISION_SCHEDULE::DOUBLING, 5) == precisions {2, 4, 8, 16, 32});
+    CHECK(first_precisions(PRECISION_SCHEDULE::FIBONACCI, 5) == precisions {2, 3, 5, 8, 13});
+    CHECK(first_precisions(PRECISION_SCHEDULE::ONE_AND_A_HALF, 5) == precisions {2, 3, 4, 6, 9});
+}
+
+TEST_CASE("Comparisons give the same result with every schedule") {
+    PRECISION_SCHEDULE previous = iterator::comparison_schedule;
+
+    for (auto schedule : {PRECISION_SCHEDULE::LINEAR, PRECISION_SCHEDULE::DOUBLING,
+                          PRECISION_SCHEDULE::FIBONACCI, PRECISION_SCHEDULE::ONE_AND_A_HALF}) {
+        INFO("schedule " << (int) schedule);
+        iterator::comparison_schedule = schedule;
+
+        real a(ones, 1);
+        real b(ones_then_two, 1);
+        real c = a + real("0");
+
+        CHECK(a < b);
+        CHECK_FALSE(b < a);
+        CHECK(b > a);
+        CHECK_FALSE(a > b);
+        CHECK_FALSE(a == b);
+        CHECK(real("3") * real("2") == real("6"));
+        CHECK_THROWS_AS(a == c, boost::real::precision_exception);
+        CHECK_THROWS_AS(real("1") / real("3") == real("1") / real("3"), boost::real::precision_exception);
+    }
+
+    iterator::comparison_schedule = previous;
+}
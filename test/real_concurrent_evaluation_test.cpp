@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/irrationals.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+
+    std::atomic<int> counted_calls{0};
+
+    int counted_ones(unsigned int) {
+        ++counted_calls;
+        return 1;
+    }
+
+    // runs work(0), ..., work(threads - 1) at the same time
+    void run_on_threads(int threads, const std::function<void(int)> &work) {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back(work, i);
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    // the numbers x - 1 < x < x * x < x + 1 < x * 2 built on x
+    std::vector<real> numbers_of(real x) {
+        return {x - real("1"), x, x * x, x + real("1"), x * real("2")};
+    }
+
+    // the digits of x fetched to refine numbers built on x six times each
+    int digits_fetched(int threads) {
+        counted_calls = 0;
+        real x(counted_ones, 1);
+        std::vector<real> numbers = numbers_of(x);
+
+        run_on_threads(threads, [&numbers, threads](int thread) {
+            for (size_t i = thread; i < numbers.size(); i += threads) {
+                auto it = numbers[i].get_real_itr().cbegin();
+                for (int j = 0; j < 6; ++j) {
+                    ++it;
+                }
+            }
+        });
+        return counted_calls;
+    }
+}
+
+TEST_CASE("An operand shared by numbers evaluated on several threads is refined once") {
+    int serial = digits_fetched(1);
+    for (int i = 0; i < 10; ++i) {
+        CHECK(digits_fetched(4) == serial);
+    }
+}
+
+TEST_CASE("Numbers sharing operands are compared on several threads") {
+    real x(ones, 1);
+    std::vector<real> sorted = numbers_of(x);
+
+    std::atomic<int> wrong{0};
+    run_on_threads(4, [&sorted, &wrong](int thread) {
+        for (int round = 0; round < 5; ++round) {
+            std::vector<real> numbers = sorted;
+            std::rotate(numbers.begin(), numbers.begin() + (thread + round) % numbers.size(), numbers.end());
+            std::sort(numbers.begin(), numbers.end());
+
+            // the sorted copies refer to the same numbers, which are only equal to themselves
+            for (size_t i = 0; i < numbers.size(); ++i) {
+                if (&numbers[i].get_real_number() != &sorted[i].get_real_number()) {
+                    ++wrong;
+                }
+            }
+        }
+    });
+    CHECK(wrong == 0);
+}
+
+TEST_CASE("Numbers sharing pi are compared on several threads") {
+    real pi = boost::real::irrational::PI<int>;
+    real two_pi = pi * real("2");
+    real pi_plus_three = pi + real("3");
+
+    std::atomic<int> wrong{0};
+    run_on_threads(4, [&](int thread) {
+        bool right = (thread % 2 == 0) ? (pi_plus_three < two_pi && pi > real("3.1")) :
+                                         (two_pi > pi_plus_three && pi < real("3.2"));
+        if (!right) {
+            ++wrong;
+        }
+    });
+    CHECK(wrong == 0);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using boost::real::OPERATION;
+
+    bool is_explicit(real number) {
+        return std::holds_alternative<boost::real::real_explicit<int>>(number.get_real_number());
+    }
+
+    // true for an explicit number or the division of two explicit numbers
+    bool is_folded(real number) {
+        if (is_explicit(number)) {
+            return true;
+        }
+        auto operation = std::get_if<boost::real::real_operation<int>>(&number.get_real_number());
+        return operation != nullptr && operation->get_operation() == OPERATION::DIVISION &&
+               std::holds_alternative<boost::real::real_explicit<int>>(operation->lhs()->get_real_number()) &&
+               std::holds_alternative<boost::real::real_explicit<int>>(operation->rhs()->get_real_number());
+    }
+
+    bool is_operation(real number) {
+        return std::holds_alternative<boost::real::real_operation<int>>(number.get_real_number());
+    }
+
+    bool is_between(const real &number, const std::string &lower, const std::string &upper) {
+        return real(lower) < number && number < real(upper);
+    }
+}
+
+TEST_CASE("Operations between explicit numbers are folded") {
+    real a("123456789.5");
+    real b("-0.25");
+    real c("98765432109876543210");
+    real d("-4");
+
+    SECTION("Integers give explicit numbers") {
+        CHECK(is_explicit(c + d));
+        CHECK(is_explicit(c - d));
+        CHECK(is_explicit(c * d));
+        CHECK(c + d == real("98765432109876543206"));
+        CHECK(c - d == real("98765432109876543214"));
+        CHECK(c * d == real("-395061728439506172840"));
+        CHECK(c - c == real("0"));
+    }
+
+    SECTION("Decimal numbers give divisions of explicit numbers") {
+        real sum = a + b;
+        real difference = a - c;
+        real product = b * c;
+
+        CHECK(is_folded(sum));
+        CHECK(is_folded(difference));
+        CHECK(is_folded(product));
+        CHECK(is_between(sum, "123456789.24", "123456789.26"));
+        CHECK(is_between(difference, "-98765432109753086420.6", "-98765432109753086420.4"));
+        CHECK(is_between(product, "-24691358027469135802.6", "-24691358027469135802.4"));
+    }
+
+    SECTION("Assignment operators") {
+        real number = c;
+        number += a;
+        number -= b;
+        number *= d;
+
+        CHECK(is_folded(number));
+        CHECK(number == real("-395061728439999999999"));
+        CHECK(is_explicit(c));
+        CHECK(c == real("98765432109876543210"));
+    }
+
+    SECTION("Rational numbers") {
+        real integer = 3_integer;
+        real third = 1_rational / 3_rational;
+
+        CHECK(is_explicit(integer + c));
+        CHECK(is_explicit(d * integer));
+        CHECK(d * integer == real("-12"));
+        CHECK(is_folded(a + third));
+        CHECK(is_between(a + third, "123456789.8333", "123456789.8334"));
+        CHECK(std::holds_alternative<boost::real::real_rational<int>>((third + integer).get_real_number()));
+    }
+
+    SECTION("Trees built from literals collapse") {
+        real tree = (a + b) * (a - real("1")) + c * real("2");
+        CHECK(is_folded(tree));
+        CHECK(is_between(tree, "197546105798472412743.62", "197546105798472412743.63"));
+    }
+}
+
+TEST_CASE("Operations are built when folding does not apply") {
+    real a("1.5");
+    real d("-4");
+
+    SECTION("Algorithmic operands") {
+        real x(ones, 1);
+        CHECK(is_operation(a + x));
+        CHECK(is_operation(x * d));
+        CHECK(!is_folded(a + (x - x)));
+    }
+
+    SECTION("Results larger than the limit") {
+        size_t previous = real::constant_folding_limit;
+        real::constant_folding_limit = 4;
+
+        real huge("1e100");
+        CHECK(!is_folded(huge + d));
+        CHECK(!is_folded(huge * huge));
+        CHECK(is_folded(a * d));
+
+        real::constant_folding_limit = 0;
+        CHECK(!is_folded(a * d));
+
+        real::constant_folding_limit = previous;
+        CHECK(is_explicit(huge + d));
+    }
+}
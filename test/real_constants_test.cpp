@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+#include <thread>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/irrationals.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using constants = boost::real::constants<int>;
+    using boost::real::CONSTANT;
+    using exact_number = boost::real::exact_number<int>;
+
+    // the first decimal digits of the constants
+    bool starts_with(const exact_number &number, const std::string &digits) {
+        return number.as_string().substr(0, digits.size()) == digits;
+    }
+}
+
+TEST_CASE("Constants are bounded by their known digits") {
+    constants registry;
+    const std::vector<std::pair<CONSTANT, std::string>> known = {
+        {CONSTANT::PI, "3.14159265358979323846264338327950288419716939937510582097494459230781640628620899"},
+        {CONSTANT::E, "2.71828182845904523536028747135266249775724709369995957496696762772407663035354759"},
+        {CONSTANT::LN2, "0.69314718055994530941723212145817656807550013436025525412068000949339362196969471"},
+        {CONSTANT::LN10, "2.30258509299404568401799145468436420760110148862877297603332790096757260967735248"},
+        {CONSTANT::SQRT2, "1.41421356237309504880168872420969807856967187537694807317667973799073247846210703"},
+    };
+
+    for (const auto &[constant, digits] : known) {
+        exact_number lower = registry.get(constant, 12, false);
+        exact_number upper = registry.get(constant, 12, true);
+        CHECK(lower < upper);
+        CHECK(starts_with(lower, digits));
+        CHECK(starts_with(upper, digits));
+
+        // lower precisions are truncations of the digits kept
+        CHECK(registry.get(constant, 3, false) <= lower);
+        CHECK(upper <= registry.get(constant, 3, true));
+        CHECK(registry.precision(constant) >= 12);
+    }
+
+    CHECK(starts_with(boost::real::irrational::E<int>.get_real_itr().cend().get_interval().lower_bound, "2.718281828459045"));
+    CHECK(boost::real::irrational::LN2<int> < boost::real::real<int>("0.6931471805599454"));
+    CHECK(boost::real::irrational::LN2<int> > boost::real::real<int>("0.6931471805599452"));
+}
+
+TEST_CASE("Constants are extended instead of recomputed") {
+    for (CONSTANT constant : {CONSTANT::PI, CONSTANT::E, CONSTANT::LN2, CONSTANT::LN10, CONSTANT::SQRT2}) {
+        constants at_once;
+        constants extended;
+        for (size_t precision : {2, 5, 9, 40, 41}) {
+            extended.get(constant, precision, false);
+        }
+        CHECK(extended.precision(constant) >= 41);
+        CHECK(extended.get(constant, 150, false) == at_once.get(constant, 150, false));
+    }
+}
+
+TEST_CASE("Constants are shared between threads") {
+    constants registry;
+    std::vector<exact_number> results(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&registry, &results, i] {
+            results[i] = registry.get(CONSTANT::LN10, 20 + 10 * i, false);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        CHECK(results[i] == registry.get(CONSTANT::LN10, 20 + 10 * i, false));
+    }
+}
+
+TEST_CASE("Runs of 0 or base - 1 in the guard digits are evaluated again") {
+    using boost::real::detail::ambiguous_guard_digits;
+    const int top = BASE - 1;
+
+    CHECK(ambiguous_guard_digits(exact_number(std::vector<int> {3, 1, 4, 0, 0, 0}, 1, true), 3, 3));
+    CHECK(ambiguous_guard_digits(exact_number(std::vector<int> {3, 1, 4}, 1, true), 3, 3));
+    CHECK(ambiguous_guard_digits(exact_number(std::vector<int> {3, 1, 4, top, top, top}, 1, true), 3, 3));
+    CHECK_FALSE(ambiguous_guard_digits(exact_number(std::vector<int> {3, 1, 4, 0, 0, 1}, 1, true), 3, 3));
+    CHECK_FALSE(ambiguous_guard_digits(exact_number(std::vector<int> {3, 1, 4, top, 0, top}, 1, true), 3, 3));
+}
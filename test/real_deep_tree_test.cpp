@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Deep operation trees are iterated without recursion") {
+    const int depth = 100000;
+    without_folding<> guard;
+
+    boost::real::real<int> one("1");
+    boost::real::real<int> sum("1");
+    for (int i = 0; i < depth; ++i) {
+        sum = sum + one;
+    }
+
+    auto sum_it = sum.get_real_itr().cbegin();
+    ++sum_it;
+    ++sum_it;
+
+    // every operand is a single digit integer, so the interval is exact
+    boost::real::exact_number<int> expected(std::vector<int> {depth + 1}, 1, true);
+    CHECK(sum_it.get_interval().lower_bound == expected);
+    CHECK(sum_it.get_interval().upper_bound == expected);
+}
+
+TEST_CASE("Deep operation trees are destroyed without recursion") {
+    const int depth = 300000;
+    without_folding<> guard;
+
+    boost::real::real<int> one("1");
+    auto one_it = one.get_real_itr();
+    {
+        boost::real::real<int> sum("1");
+        for (int i = 0; i < depth; ++i) {
+            sum = sum + one;
+        }
+
+        // an iterator copy shares the root operation, it must keep the tree alive
+        auto sum_it = sum.get_real_itr().cbegin();
+        sum = one;
+        ++sum_it;
+        CHECK(sum_it.get_interval().lower_bound == boost::real::exact_number<int>(std::vector<int> {depth + 1}, 1, true));
+    }
+
+    // the shared leaf survives the tree
+    CHECK(one.get_real_itr().get_interval() == one_it.get_interval());
+}
@@ -0,0 +1,50 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Evaluate to a target error") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+
+    // base^-2
+    exact_number target_error(std::vector<int> {1}, -1, true);
+
+    SECTION("Operands of different magnitudes") {
+        real number = real("123456789012345678901234567890") * real(ones, 1) + real(ones, -3) * real(one_and_max, 1);
+        boost::real::interval<int> approximation = real::evaluate(number, target_error);
+
+        CHECK(approximation.upper_bound - approximation.lower_bound <= target_error);
+        CHECK(approximation.lower_bound <= approximation.upper_bound);
+
+        // the approximation agrees with the uniformly iterated one
+        auto full = number.get_real_itr().cbegin();
+        full.iterate_n_times(9);
+        CHECK(approximation.lower_bound <= full.get_interval().upper_bound);
+        CHECK(full.get_interval().lower_bound <= approximation.upper_bound);
+    }
+
+    SECTION("Functions and divisions") {
+        real number = real::exp(real("1")) / real("3") - real::log(real("2"));
+        boost::real::interval<int> approximation = real::evaluate(number, target_error);
+
+        CHECK(approximation.upper_bound - approximation.lower_bound <= target_error);
+
+        real same_number = real::exp(real("1")) / real("3") - real::log(real("2"));
+        auto full = same_number.get_real_itr().cbegin();
+        full.iterate_n_times(4);
+        CHECK(approximation.lower_bound <= full.get_interval().upper_bound);
+        CHECK(full.get_interval().lower_bound <= approximation.upper_bound);
+    }
+
+    SECTION("Targets beyond the maximum precision throw") {
+        exact_number too_small(std::vector<int> {1}, -20, true);
+        CHECK_THROWS_AS(real::evaluate(real(ones, 1) * real(ones, 1), too_small), boost::real::precision_exception);
+    }
+
+    SECTION("Non-positive targets throw") {
+        exact_number negative(std::vector<int> {1}, -2, false);
+        CHECK_THROWS_AS(real::evaluate(real(ones, 1) * real(ones, 1), exact_number()), boost::real::non_positive_target_error_exception);
+        CHECK_THROWS_AS(real::evaluate(real(ones, 1) * real(ones, 1), negative), boost::real::non_positive_target_error_exception);
+    }
+}
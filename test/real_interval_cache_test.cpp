@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using cache = boost::real::interval_cache<int>;
+
+    int counted_calls = 0;
+
+    int counted_ones(unsigned int) {
+        ++counted_calls;
+        return 1;
+    }
+
+    boost::real::interval<int> interval_of(int first_digit, size_t digits) {
+        boost::real::interval<int> result;
+        result.lower_bound = boost::real::exact_number<int>(std::vector<int>(digits, first_digit), 1, true);
+        result.upper_bound = result.lower_bound;
+        return result;
+    }
+}
+
+TEST_CASE("Iterators of the same number share the intervals they computed") {
+    real number = real(counted_ones, 1) * real("7") + real(ones, 0);
+
+    auto first = number.get_real_itr().cbegin();
+    auto second = number.get_real_itr().cbegin();
+    for (int i = 0; i < 6; ++i) {
+        ++first;
+    }
+    REQUIRE(first.get_interval_cache() == second.get_interval_cache());
+    CHECK(first.get_interval_cache()->size() == 6);
+
+    int calls = counted_calls;
+    for (int i = 0; i < 6; ++i) {
+        ++second;
+        CHECK(second.get_interval() == *first.get_interval_cache()->find(second.get_precision()));
+    }
+    CHECK(counted_calls == calls);
+    CHECK(second.get_interval() == first.get_interval());
+
+    // past the cached precisions the interval is refined from the operands as usual
+    ++first;
+    ++second;
+    CHECK(second.get_interval() == first.get_interval());
+}
+
+TEST_CASE("A cached interval gives the same refinement as the computed one") {
+    auto iterate = [](real number, int times) {
+        auto it = number.get_real_itr().cbegin();
+        for (int i = 0; i < times; ++i) {
+            ++it;
+        }
+        return it.get_interval();
+    };
+
+    real number = real(ones, 1) * real(one_and_max, 1) - real("3");
+    iterate(number, 3);
+    CHECK(iterate(number, 8) == iterate(real(ones, 1) * real(one_and_max, 1) - real("3"), 8));
+}
+
+TEST_CASE("Interval cache memory budget") {
+    cache intervals;
+    intervals.set_budget(0);
+    intervals.insert(1, interval_of(1, 4));
+    CHECK(intervals.size() == 0);
+
+    intervals.set_budget(1 << 20);
+    for (size_t p = 1; p <= 5; ++p) {
+        intervals.insert(p, interval_of((int) p, 4));
+    }
+    CHECK(intervals.size() == 5);
+    size_t memory = intervals.memory_usage();
+
+    // the least precise intervals are evicted first
+    intervals.set_budget(memory - 1);
+    CHECK(intervals.size() == 4);
+    CHECK_FALSE(intervals.find(1));
+    CHECK(*intervals.find(5) == interval_of(5, 4));
+    CHECK(intervals.memory_usage() < memory);
+}
@@ -8,7 +8,8 @@ TEMPLATE_TEST_CASE("Operators + * boost::real::const_precision_iterator", "[temp
 
     using real=boost::real::real<TestType>;
 
-    // Explicit numbers
+    // Explicit numbers, kept as operands of the operations below
+    without_folding<TestType> guard;
     real a("9999999999999999999999999999999");
     real b("9999999999999999999999999999999");
     real c("9999999999999999999999999999999");
@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+#include <functional>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using iterator = boost::real::const_precision_iterator<int>;
+
+    int alternating(unsigned int n) { /* 1 base-2 1 base-2 ... */
+        return (n % 2 == 0) ? 1 : BASE - 2;
+    }
+
+    // the intervals of the first iterations of the number built by make_number
+    std::vector<boost::real::interval<int>> intervals(const std::function<real()> &make_number, bool incremental) {
+        bool previous = iterator::incremental_refinement;
+        iterator::incremental_refinement = incremental;
+
+        real number = make_number();
+        auto it = number.get_real_itr().cbegin();
+        std::vector<boost::real::interval<int>> result = {it.get_interval()};
+        for (int i = 0; i < 8; ++i) {
+            ++it;
+            result.push_back(it.get_interval());
+        }
+
+        iterator::incremental_refinement = previous;
+        return result;
+    }
+}
+
+TEST_CASE("Incremental refinement gives the same intervals as a full recomputation") {
+    std::vector<std::function<real()>> expressions = {
+        [] { return real(ones, 1) + real(one_and_max, 1); },
+        [] { return real(ones, 1) - real(alternating, 1); },
+        [] { return real(one_and_max, 1, false) - real(ones, 1); },
+        [] { return real(one_and_max, 1) * real(alternating, 1); },
+        [] { return real(ones, 1, false) * real(one_and_max, 1, false); },
+        [] { return real(alternating, 2, false) * real(ones, 1); },
+        [] { return real("123456789123456789.987654321") * real(one_and_max, 1) + real(alternating, 0); },
+        [] { return (real(ones, 1) - real(ones, 1)) * real(alternating, 1); },
+        [] { return (real(ones, 1) * real(one_and_max, 1) - real(alternating, 1)) * (real(ones, 1) + real("-1.5")); },
+    };
+
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        INFO("expression " << i);
+        auto incremental = intervals(expressions[i], true);
+        auto full = intervals(expressions[i], false);
+
+        REQUIRE(incremental.size() == full.size());
+        for (size_t p = 0; p < full.size(); ++p) {
+            INFO("iteration " << p);
+            CHECK(incremental[p] == full[p]);
+        }
+    }
+}
+
+TEST_CASE("exact_number accumulate adds in place") {
+    using exact_number = boost::real::exact_number<int>;
+
+    exact_number number(std::vector<int> {1, BASE - 1, BASE - 1}, 1, true);
+    exact_number delta(std::vector<int> {1}, -1, true);
+    exact_number expected = number + delta;
+    number.accumulate(delta);
+    CHECK(number == expected);
+    CHECK(number.digits == std::vector<int> {2});
+
+    delta.positive = false;
+    expected = number + delta;
+    number.accumulate(delta);
+    CHECK(number == expected);
+    CHECK(number.digits == std::vector<int> {1, BASE - 1, BASE - 1});
+
+    // deltas that reach the leading digit fall back to a full addition
+    exact_number large(std::vector<int> {3}, 2, false);
+    expected = number + large;
+    number.accumulate(large);
+    CHECK(number == expected);
+}
@@ -2,12 +2,14 @@
 #include <map>
 
 #include <real/real.hpp>
+#include <test_helpers.hpp>
 
 TEMPLATE_TEST_CASE("Operators * *  boost::real::const_precision_iterator", "[template]", int, long, long long) {
     
     using real=boost::real::real<TestType>;
 
-    // Explicit numbers
+    // Explicit numbers, kept as operands of the operations below
+    without_folding<TestType> guard;
     real a("999999999999999999");
     real b("999999999999999999");
     real c("999999999999999999");
@@ -0,0 +1,43 @@
+#include <catch2/catch.hpp>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    unsigned int digit_requests = 0;
+
+    int counted_ones(unsigned int) {
+        ++digit_requests;
+        return 1;
+    }
+}
+
+TEST_CASE("Shared operands are refined once per precision") {
+    using real = boost::real::real<int>;
+
+    digit_requests = 0;
+    real x(counted_ones, 1);
+    unsigned int initial_requests = digit_requests;
+
+    // x appears in every term of the polynomial x^8 + x^7 + ... + x
+    real polynomial = x;
+    for (int i = 0; i < 7; ++i) {
+        polynomial = (polynomial + real("1")) * x;
+    }
+
+    auto it = polynomial.get_real_itr().cbegin();
+    const int iterations = 5;
+    for (int i = 0; i < iterations; ++i) {
+        ++it;
+    }
+
+    // one new digit of x per iteration, however many times x is used
+    CHECK(digit_requests - initial_requests == (unsigned int) iterations);
+
+    // x was refined to the precision of the polynomial
+    auto x_it = x.get_real_itr().cbegin();
+    for (int i = 0; i < iterations; ++i) {
+        ++x_it;
+    }
+    CHECK(x.get_real_itr().get_interval() == x_it.get_interval());
+}
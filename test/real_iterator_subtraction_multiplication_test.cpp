@@ -8,7 +8,8 @@ using  real=boost::real::real<>;
 
 TEST_CASE("Operators - * boost::real::const_precision_iterator") {
     
-    // Explicit numbers
+    // Explicit numbers, kept as operands of the operations below
+    without_folding<> guard;
     real a("9999999999999999999999999999999");
     real b("9999999999999999999999999999999");
     real c("9999999999999999999999999999999");
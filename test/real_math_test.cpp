@@ -1,6 +1,15 @@
 #include <catch2/catch.hpp>
+#include <real/irrationals.hpp>
 #include <test_helpers.hpp>
 
+namespace {
+	// the first decimal digits of number
+	template <typename T>
+	bool starts_with(const boost::real::exact_number<T> &number, const std::string &digits){
+		return number.as_string().substr(0, digits.size()) == digits;
+	}
+}
+
 TEST_CASE("TRIGONOMETRIC FUNCTIONS"){
 	using real = boost::real::real<int>;
 	SECTION("BASIC TRIGONOMETRIC VALUES"){
@@ -777,6 +786,126 @@ TEST_CASE("LOGARITHM AND EXPONENT"){
 
 }
 
+TEMPLATE_TEST_CASE("EXPONENT OF LARGE AND SMALL ARGUMENTS", "[template]", int, long, long long){
+	using real = boost::real::real<TestType>;
+
+	SECTION("LARGE ARGUMENTS"){
+		real value = real::exp(real("1000")); // exp(1000) = 1.9700711140170469938888793522433231×10^434
+		CHECK(value > real("1.97007111401704699388887935224e434"));
+		CHECK(value < real("1.97007111401704699388887935225e434"));
+
+		value = real::exp(real("-1000")); // exp(-1000) = 5.0759588975494567652918094795743369×10^-435
+		CHECK(value > real("5.07595889754945676529180947957e-435"));
+		CHECK(value < real("5.07595889754945676529180947958e-435"));
+
+		value = real::exp(real("-2.5")); // exp(-2.5) = 0.08208499862389879516952867446715980
+		CHECK(value > real("0.08208499862389879516952867446"));
+		CHECK(value < real("0.08208499862389879516952867447"));
+	}
+
+	SECTION("SMALL ARGUMENTS"){
+		real value = real::exp(real("-0.000001")); // exp(-0.000001) = 0.99999900000049999983333337499999
+		CHECK(value > real("0.9999990000004999998333333749999"));
+		CHECK(value < real("0.9999990000004999998333333750000"));
+	}
+
+	SECTION("EXPONENT OF ONE"){
+		real value = real::exp(real("1"));
+		boost::real::exact_number<TestType> e_lower = boost::real::constants<TestType>::shared().get(boost::real::CONSTANT::E, 8, false);
+		boost::real::exact_number<TestType> e_upper = boost::real::constants<TestType>::shared().get(boost::real::CONSTANT::E, 8, true);
+		auto it = value.get_real_itr().cbegin();
+		it.iterate_n_times(8);
+		CHECK(it.get_interval().lower_bound <= e_upper);
+		CHECK(e_lower <= it.get_interval().upper_bound);
+	}
+
+	SECTION("BOUNDS OF THE SERIES"){
+		using exact_number = boost::real::exact_number<TestType>;
+		// e^1 and e^-3 to 40 decimal digits
+		CHECK(starts_with(boost::real::exponent(exact_number("1"), 6, false), "2.7182818284590452353602874713526624977572"));
+		CHECK(starts_with(boost::real::exponent(exact_number("1"), 6, true), "2.7182818284590452353602874713526624977572"));
+		CHECK(starts_with(boost::real::exponent(exact_number("-3"), 6, false), "0.04978706836786394297934241565006177663169"));
+		CHECK(starts_with(boost::real::exponent(exact_number("-3"), 6, true), "0.04978706836786394297934241565006177663169"));
+	}
+}
+
+TEMPLATE_TEST_CASE("LOGARITHM OF LARGE AND SMALL ARGUMENTS", "[template]", int, long, long long){
+	using real = boost::real::real<TestType>;
+
+	SECTION("LARGE ARGUMENTS"){
+		real value = real::log(real("1e100")); // ln(10^100) = 230.2585092994045684017991454684364207601
+		CHECK(value > real("230.25850929940456840179914546843642076"));
+		CHECK(value < real("230.25850929940456840179914546843642077"));
+
+		value = real::log(real("1e-50")); // ln(10^-50) = -115.1292546497022842008995727342182103800
+		CHECK(value > real("-115.12925464970228420089957273421821039"));
+		CHECK(value < real("-115.12925464970228420089957273421821038"));
+	}
+
+	SECTION("ARGUMENTS CLOSE TO ONE"){
+		real value = real::log(real("1.000001")); // ln(1.000001) = 9.999995000003333330833335333331666668×10^-7
+		CHECK(value > real("0.0000009999995000003333330833335333331"));
+		CHECK(value < real("0.0000009999995000003333330833335333332"));
+
+		value = real::log(real("0.5")); // ln(0.5) = -0.6931471805599453094172321214581765680
+		CHECK(value > real("-0.69314718055994530941723212145817656808"));
+		CHECK(value < real("-0.69314718055994530941723212145817656807"));
+	}
+
+	SECTION("BOUNDS OF THE SERIES"){
+		using exact_number = boost::real::exact_number<TestType>;
+		// ln(3) to 40 decimal digits, which is not a power of two and needs the series
+		CHECK(starts_with(boost::real::logarithm(exact_number("3"), 6, false), "1.098612288668109691395245236922525704647"));
+		CHECK(starts_with(boost::real::logarithm(exact_number("3"), 6, true), "1.098612288668109691395245236922525704647"));
+	}
+}
+
+TEMPLATE_TEST_CASE("SINE AND COSINE OF LARGE ARGUMENTS", "[template]", int, long, long long){
+	using real = boost::real::real<TestType>;
+
+	SECTION("LARGE ARGUMENTS"){
+		real value = real::sin(real("100")); // sin(100) = -0.5063656411097587936565576104597854320650
+		CHECK(value > real("-0.50636564110975879365655761045978543207"));
+		CHECK(value < real("-0.50636564110975879365655761045978543206"));
+
+		value = real::cos(real("1000000")); // cos(10^6) = 0.9367521275331447869385325350749187757081
+		CHECK(value > real("0.93675212753314478693853253507491877570"));
+		CHECK(value < real("0.93675212753314478693853253507491877571"));
+
+		value = real::sin(real("1e20")); // sin(10^20) = -0.6452512852657808442058117113125230074069
+		CHECK(value > real("-0.64525128526578084420581171131252300741"));
+		CHECK(value < real("-0.64525128526578084420581171131252300740"));
+
+		value = real::cos(real("-12345.678")); // cos(-12345.678) = 0.7101193587161447395014489233342456842695
+		CHECK(value > real("0.71011935871614473950144892333424568426"));
+		CHECK(value < real("0.71011935871614473950144892333424568427"));
+	}
+
+	SECTION("EXTREMA WITHIN THE INTERVAL OF THE ARGUMENT"){
+		// the interval of pi contains a minimum of cos, and that of pi / 2 a maximum of sin
+		auto cos_pi = real::cos(boost::real::irrational::PI<TestType>).get_real_itr().cbegin();
+		auto sin_half_pi = real::sin(boost::real::irrational::PI<TestType> / real("2")).get_real_itr().cbegin();
+		for(int i = 0; i < 4; ++i){
+			++cos_pi;
+			++sin_half_pi;
+			CHECK(cos_pi.get_interval().lower_bound == boost::real::literals::minus_one_exact<TestType>);
+			CHECK(!cos_pi.get_interval().upper_bound.positive);
+			CHECK(sin_half_pi.get_interval().upper_bound == boost::real::literals::one_exact<TestType>);
+			CHECK(sin_half_pi.get_interval().lower_bound.positive);
+		}
+	}
+
+	SECTION("BOUNDS OF THE SERIES"){
+		using exact_number = boost::real::exact_number<TestType>;
+		// sin(1) and cos(1) to 40 decimal digits
+		for(bool upper : {false, true}){
+			const auto values = boost::real::sin_cos(exact_number("1"), 6, upper);
+			CHECK(starts_with(std::get<0>(values), "0.8414709848078965066525023216302989996225"));
+			CHECK(starts_with(std::get<1>(values), "0.5403023058681397174009366074429766037323"));
+		}
+	}
+}
+
 TEST_CASE("SQURE ROOT FUNCTION TEST"){
 	using real = boost::real::real<int>;
 	using TYPE = boost::real::TYPE;
@@ -0,0 +1,130 @@
+#include <catch2/catch.hpp>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using boost::real::OPERATION;
+
+    const boost::real::real_operation<int>& operation_of(real &number) {
+        return std::get<boost::real::real_operation<int>>(number.get_real_number());
+    }
+
+    // true if the intervals of both numbers, iterated the same number of times, overlap
+    bool overlap(real lhs, real rhs, int iterations) {
+        auto lhs_it = lhs.get_real_itr().cbegin();
+        auto rhs_it = rhs.get_real_itr().cbegin();
+        lhs_it.iterate_n_times(iterations);
+        rhs_it.iterate_n_times(iterations);
+        return lhs_it.get_interval().lower_bound <= rhs_it.get_interval().upper_bound &&
+               rhs_it.get_interval().lower_bound <= lhs_it.get_interval().upper_bound;
+    }
+}
+
+TEST_CASE("Chains of += and *= build a single n-ary node") {
+    std::vector<real> terms = {real(ones, 1), real("-2.5"), real(one_and_max, -1), real("7"), real(ones, 2)};
+
+    real sum = terms[0];
+    real product = terms[0];
+    for (size_t i = 1; i < terms.size(); ++i) {
+        sum += terms[i];
+        product *= terms[i];
+    }
+
+    CHECK(operation_of(sum).get_operation() == OPERATION::SUM);
+    CHECK(operation_of(sum).operand_count() == terms.size());
+    CHECK(operation_of(product).get_operation() == OPERATION::PRODUCT);
+    CHECK(operation_of(product).operand_count() == terms.size());
+
+    // the same operations as binary trees
+    real binary_sum = terms[0];
+    real binary_product = terms[0];
+    for (size_t i = 1; i < terms.size(); ++i) {
+        binary_sum = binary_sum + terms[i];
+        binary_product = binary_product * terms[i];
+    }
+    CHECK(operation_of(binary_sum).get_operation() == OPERATION::ADDITION);
+
+    for (int iterations = 0; iterations < 6; ++iterations) {
+        CHECK(overlap(sum, binary_sum, iterations));
+        CHECK(overlap(product, binary_product, iterations));
+    }
+}
+
+TEST_CASE("Sums and products of exact numbers are exact") {
+    without_folding<> guard;
+    real sum("1");
+    real product("1");
+    for (int i = 0; i < 100; ++i) {
+        sum += real("0.5");
+        product *= real("-2");
+    }
+
+    CHECK(sum == real("51"));
+    CHECK(product == real("1267650600228229401496703205376"));
+}
+
+TEST_CASE("Products of intervals around zero") {
+    real x(ones, 1);
+    real around_zero = x - x;
+
+    real product = around_zero * real("-3");
+    product *= x;
+    product *= real("-1");
+    CHECK(operation_of(product).get_operation() == OPERATION::PRODUCT);
+
+    auto it = product.get_real_itr().cbegin();
+    for (int i = 0; i < 5; ++i) {
+        ++it;
+        CHECK(it.get_interval().lower_bound <= boost::real::exact_number<int>());
+        CHECK(boost::real::exact_number<int>() <= it.get_interval().upper_bound);
+    }
+}
+
+TEST_CASE("Extending a shared sum does not change the other numbers using it") {
+    without_folding<> guard;
+    real sum = real("1") + real("2");
+    sum += real("3");
+
+    real copy = sum;
+    auto copy_it = sum.get_real_itr();
+    real parent = sum * real("2");
+
+    sum += real("4");
+    sum += real("5");
+
+    CHECK(operation_of(sum).operand_count() == 5);
+    CHECK(operation_of(copy).operand_count() == 3);
+    CHECK(sum == real("15"));
+    CHECK(copy == real("6"));
+    CHECK(parent == real("12"));
+    CHECK(copy_it.cend().get_interval() == copy.get_real_itr().cend().get_interval());
+}
+
+TEST_CASE("Sums extended in place after being evaluated") {
+    boost::real::exact_number<int> target_error(std::vector<int> {1}, -2, true);
+    real x(ones, 1);
+    real sum = x + real("1");
+    sum += x;
+
+    real::evaluate(sum, target_error);
+    CHECK(sum > real("2"));
+
+    // nothing else refers to the sum, so it is extended in place
+    const boost::real::real_number<int> *number = &sum.get_real_number();
+    sum += x;
+    sum += real("2");
+    CHECK(&sum.get_real_number() == number);
+    CHECK(operation_of(sum).operand_count() == 5);
+
+    real expected = x * real("3") + real("3");
+    CHECK(overlap(sum, expected, 4));
+    CHECK(sum > real("6"));
+
+    boost::real::interval<int> approximation = real::evaluate(sum, target_error);
+    CHECK(approximation.upper_bound - approximation.lower_bound <= target_error);
+    CHECK(approximation.lower_bound <= expected.get_real_itr().cend().get_interval().upper_bound);
+    CHECK(expected.get_real_itr().cend().get_interval().lower_bound <= approximation.upper_bound);
+}
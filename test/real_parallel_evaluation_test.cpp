@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+namespace {
+    using real = boost::real::real<int>;
+    using iterator = boost::real::const_precision_iterator<int>;
+
+    // sum of products of leaves, balanced so that most nodes are independent
+    real balanced_tree(int first, int last) {
+        if (last - first == 1) {
+            return real(std::to_string(first)) * real(ones, 1);
+        }
+        int middle = (first + last) / 2;
+        return balanced_tree(first, middle) + balanced_tree(middle, last);
+    }
+
+    // the intervals of the first iterations of the number built by make_number
+    std::vector<boost::real::interval<int>> intervals(const std::function<real()> &make_number,
+                                                      boost::real::work_stealing_pool *pool) {
+        iterator::thread_pool = pool;
+        real number = make_number();
+        auto it = number.get_real_itr().cbegin();
+        std::vector<boost::real::interval<int>> result;
+        for (int i = 0; i < 6; ++i) {
+            ++it;
+            result.push_back(it.get_interval());
+        }
+        iterator::thread_pool = nullptr;
+        return result;
+    }
+}
+
+TEST_CASE("Work stealing pool") {
+    boost::real::work_stealing_pool pool(3);
+    CHECK(pool.size() == 3);
+
+    SECTION("Every task of a group runs before wait returns") {
+        std::atomic<int> sum{0};
+        boost::real::task_group group(pool);
+        for (int i = 1; i <= 1000; ++i) {
+            group.run([&sum, i] { sum += i; });
+        }
+        group.wait();
+        CHECK(sum == 500500);
+    }
+
+    SECTION("Tasks can wait for nested tasks") {
+        std::atomic<int> leaves{0};
+        boost::real::task_group group(pool);
+        for (int i = 0; i < 8; ++i) {
+            group.run([&pool, &leaves] {
+                boost::real::task_group nested(pool);
+                for (int j = 0; j < 8; ++j) {
+                    nested.run([&leaves] { ++leaves; });
+                }
+                nested.wait();
+            });
+        }
+        group.wait();
+        CHECK(leaves == 64);
+    }
+
+    SECTION("Exceptions are rethrown by wait") {
+        boost::real::task_group group(pool);
+        group.run([] { throw std::runtime_error("task"); });
+        group.run([] {});
+        CHECK_THROWS_AS(group.wait(), std::runtime_error);
+    }
+}
+
+TEST_CASE("Parallel evaluation gives the same intervals as the serial one") {
+    boost::real::work_stealing_pool pool(4);
+
+    std::vector<std::function<real()>> expressions = {
+        [] { return balanced_tree(1, 64); },
+        [] { return balanced_tree(1, 16) * (balanced_tree(3, 9) - real(one_and_max, 1)); },
+        [] { return real::exp(real("0.5") + real(ones, 0)) * real::sin(real("1.2") * real("4.6")); },
+        [] { return real::log(real(ones, 1) + real("2")) - real::cos(real(ones, 0)) / real(one_and_max, 1); },
+        [] { real x = real(ones, 0) + real("1"); return real::tan(x) + x * x; },
+    };
+
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        INFO("expression " << i);
+        auto parallel = intervals(expressions[i], &pool);
+        auto serial = intervals(expressions[i], nullptr);
+
+        REQUIRE(parallel.size() == serial.size());
+        for (size_t p = 0; p < serial.size(); ++p) {
+            INFO("iteration " << p);
+            CHECK(parallel[p] == serial[p]);
+        }
+    }
+}
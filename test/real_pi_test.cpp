@@ -248,4 +248,30 @@ TEST_CASE("Pi") {
 
 	}
 
-}
\ No newline at end of file
+}
+TEST_CASE("Pi from the binary splitting Chudnovsky series") {
+	using constants = boost::real::constants<int>;
+	using boost::real::CONSTANT;
+
+	// well beyond the 300 decimal digits of the former sqrt(10005) constant
+	const unsigned int count = 400;
+	std::vector<int> at_once(count);
+	constants().get_digits(CONSTANT::PI, 0, count, at_once.data());
+
+	// extending the digits already computed gives the same digits
+	constants extended;
+	std::vector<int> digits(count);
+	for (unsigned int n : {1u, 7u, 30u, 31u, 150u, count}) {
+		extended.get_digits(CONSTANT::PI, 0, n, digits.data());
+		CHECK(std::equal(digits.begin(), digits.begin() + n, at_once.begin()));
+	}
+	extended.get_digits(CONSTANT::PI, count - 5, 5, digits.data());
+	CHECK(std::equal(digits.begin(), digits.begin() + 5, at_once.end() - 5));
+
+	std::string hardcoded_Pi("3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679");
+	boost::real::exact_number<int> pi(std::vector<int> (at_once.begin(), at_once.begin() + 14), 1, true);
+	CHECK(pi.as_string().substr(0, hardcoded_Pi.size()) == hardcoded_Pi);
+
+	CHECK(boost::real::irrational::pi_nth_digit<int>(0) == 3);
+	CHECK(boost::real::irrational::pi_nth_digit<int>(count - 1) == at_once.back());
+}
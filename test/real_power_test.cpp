@@ -691,4 +691,78 @@ TEST_CASE("Non-Integral Power"){
         CHECK(result > lower_bound);
         CHECK(result < upper_bound);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Integer powers are rounded outwards to the precision of the iterator") {
+    using real = boost::real::real<int>;
+    using exact_number = boost::real::exact_number<int>;
+
+    real x(ones, 1);
+    real exponent("1000");
+    real result = real::power(x, exponent);
+
+    exact_number exact_exponent(std::vector<int> {1000}, 1, true);
+    auto x_it = x.get_real_itr().cbegin();
+    auto result_it = result.get_real_itr().cbegin();
+    for (int i = 0; i < 6; ++i) {
+        ++x_it;
+        ++result_it;
+
+        // the powers of the bounds of x, computed exactly
+        const exact_number &lower = result_it.get_interval().lower_bound;
+        const exact_number &upper = result_it.get_interval().upper_bound;
+        CHECK(lower <= exact_number::binary_exponentiation(x_it.get_interval().lower_bound, exact_exponent));
+        CHECK(exact_number::binary_exponentiation(x_it.get_interval().upper_bound, exact_exponent) <= upper);
+
+        CHECK(lower.digits.size() <= result_it.get_precision());
+        CHECK(upper.digits.size() <= result_it.get_precision());
+    }
+}
+
+TEST_CASE("Integer powers of exact numbers are exact") {
+    using real = boost::real::real<int>;
+
+    CHECK(real::power(real("3"), real("41")) == real("36472996377170786403"));
+    CHECK(real::power(real("-7"), real("23")) == real("-27368747340080916343"));
+    CHECK(real::power(real("-3"), real("5")) == real("-243"));
+    CHECK(real::power(real("-3"), real("4")) == real("81"));
+
+    real x(ones, 1);
+    real around_zero = real::power(x - x, real("3"));
+    auto it = around_zero.get_real_itr().cbegin();
+    for (int i = 0; i < 4; ++i) {
+        ++it;
+        CHECK(it.get_interval().lower_bound <= boost::real::exact_number<int>());
+        CHECK(boost::real::exact_number<int>() <= it.get_interval().upper_bound);
+    }
+}
+
+TEST_CASE("Squares and powers of exact numbers") {
+    using exact_number = boost::real::exact_number<int>;
+    const int max_digit = (std::numeric_limits<int>::max() / 4) * 2 - 1;
+
+    // both the schoolbook and the Karatsuba squaring, against the general multiplication
+    for (size_t size : {1, 2, 7, 99, 100, 101, 250}) {
+        std::vector<int> digits(size);
+        for (size_t i = 0; i < size; ++i) {
+            digits[i] = (i % 3 == 0) ? max_digit : (int) (i * 7919 % max_digit) + 1;
+        }
+        exact_number number(digits, 2, false);
+        exact_number square = number;
+        square.square();
+        CHECK(square == number * number);
+        CHECK(square.positive);
+    }
+
+    exact_number three(std::vector<int> {3}, 1, false);
+    exact_number power(std::vector<int> {1}, 1, true);
+    for (unsigned long long n = 0; n < 70; ++n) {
+        CHECK(exact_number::binary_exponentiation(three, n) == power);
+        CHECK(exact_number::binary_exponentiation(three, exact_number(std::vector<int> {(int) n}, 1, true)) == power);
+        power = power * three;
+    }
+
+    // an exponent that does not fit in an unsigned long long
+    exact_number minus_one(std::vector<int> {1}, 1, false);
+    exact_number huge_odd(std::vector<int> {1, 0, 0, 1}, 4, true);
+    CHECK(exact_number::binary_exponentiation(minus_one, huge_odd) == minus_one);
+}
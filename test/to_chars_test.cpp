@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <real/to_chars.hpp>
+#include <test_helpers.hpp>
+
+#include <string>
+
+template <typename T>
+std::string format(const boost::real::exact_number<T>& number, std::chars_format fmt, int digits,
+                   boost::real::ROUNDING rounding = boost::real::ROUNDING::NEAREST) {
+    char buffer[128];
+    auto [ptr, ec] = boost::real::to_chars(buffer, buffer + sizeof(buffer), number, fmt, digits, rounding);
+    REQUIRE(ec == std::errc());
+    return std::string(buffer, ptr);
+}
+
+TEMPLATE_TEST_CASE("to_chars for exact numbers", "[template]", int, long long) {
+    using exact_number = boost::real::exact_number<TestType>;
+    using boost::real::ROUNDING;
+    const TestType base = boost::real::detail::limb_base<TestType>();
+
+    exact_number half(std::vector<TestType> {base / 2}, 0, true);
+    exact_number minus_one_and_half(std::vector<TestType> {1, base / 2}, 1, false);
+    exact_number third(std::vector<TestType> {base / 3, base / 3, base / 3}, 0, true);
+    auto explicit_number = [](const std::string& number) {
+        return boost::real::real_explicit<TestType>(number).get_exact_number();
+    };
+    exact_number large = explicit_number("1234567890123456789012345678901234567890");
+
+    SECTION("Fixed notation") {
+        CHECK(format(explicit_number("123"), std::chars_format::fixed, 2) == "123.00");
+        CHECK(format(explicit_number("0"), std::chars_format::fixed, 3) == "0.000");
+        CHECK(format(half, std::chars_format::fixed, 3) == "0.500");
+        CHECK(format(third, std::chars_format::fixed, 5) == "0.33333");
+        CHECK(format(large, std::chars_format::fixed, 0) == "1234567890123456789012345678901234567890");
+    }
+
+    SECTION("Rounding of the last digit") {
+        CHECK(format(half, std::chars_format::fixed, 0) == "1");
+        CHECK(format(half, std::chars_format::fixed, 0, ROUNDING::TOWARD_ZERO) == "0");
+        CHECK(format(third, std::chars_format::fixed, 3, ROUNDING::UP) == "0.334");
+        CHECK(format(third, std::chars_format::fixed, 3, ROUNDING::DOWN) == "0.333");
+        CHECK(format(minus_one_and_half, std::chars_format::fixed, 0, ROUNDING::DOWN) == "-2");
+        CHECK(format(minus_one_and_half, std::chars_format::fixed, 0, ROUNDING::UP) == "-1");
+        CHECK(format(minus_one_and_half, std::chars_format::fixed, 1, ROUNDING::DOWN) == "-1.5");
+        CHECK(format(explicit_number("999"), std::chars_format::fixed, 0, ROUNDING::UP) == "999");
+    }
+
+    SECTION("Scientific notation") {
+        CHECK(format(explicit_number("0"), std::chars_format::scientific, 2) == "0.00e+00");
+        CHECK(format(half, std::chars_format::scientific, 0) == "5e-01");
+        CHECK(format(large, std::chars_format::scientific, 5) == "1.23457e+39");
+        CHECK(format(large, std::chars_format::scientific, 5, ROUNDING::DOWN) == "1.23456e+39");
+        CHECK(format(third, std::chars_format::scientific, 2, ROUNDING::UP) == "3.34e-01");
+        CHECK(format(explicit_number("999"), std::chars_format::scientific, 1) == "1.0e+03");
+
+        exact_number tiny(std::vector<TestType> {base / 2}, -1, true);
+        CHECK(format(tiny, std::chars_format::scientific, 3).substr(5) == "e-" + std::to_string(std::to_string(base).size()));
+    }
+
+    SECTION("Small buffers are reported") {
+        char buffer[4];
+        auto result = boost::real::to_chars(buffer, buffer + sizeof(buffer), large, std::chars_format::fixed, 0);
+        CHECK(result.ec == std::errc::value_too_large);
+        result = boost::real::to_chars(buffer, buffer + sizeof(buffer), half, std::chars_format::scientific, 3);
+        CHECK(result.ec == std::errc::value_too_large);
+        result = boost::real::to_chars(buffer, buffer + sizeof(buffer), half, std::chars_format::fixed, 3);
+        CHECK(result.ec == std::errc::value_too_large);
+    }
+}
+
+TEST_CASE("to_chars for intervals") {
+    boost::real::real<int> one_third = boost::real::real<int>("1") / boost::real::real<int>("3");
+    auto bounds = one_third.get_real_itr().cend().get_interval();
+
+    char buffer[64];
+    auto [ptr, ec] = boost::real::to_chars(buffer, buffer + sizeof(buffer), bounds, std::chars_format::fixed, 4);
+    CHECK(ec == std::errc());
+    CHECK(std::string(buffer, ptr) == "[0.3333, 0.3334]");
+
+    boost::real::interval<int> number;
+    number.lower_bound = boost::real::exact_number<int>(std::vector<int> {25}, 1, true);
+    number.upper_bound = number.lower_bound;
+    auto result = boost::real::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::scientific, 1);
+    CHECK(std::string(buffer, result.ptr) == "2.5e+01");
+}